@@ -137,6 +137,15 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
             fprintf(stderr, "Answers NOT MATCHING (bos coster != djb)\n");
         }
 
+        run_result_t<GroupType> result_pippenger =
+            profile_multiexp<GroupType, FieldType, policies::multiexp_method_pippenger>(group_elements, scalars);
+        printf("\t%lld", result_pippenger.first);
+        fflush(stdout);
+
+        if (compare_answers && (result_bos_coster.second != result_pippenger.second)) {
+            fprintf(stderr, "Answers NOT MATCHING (bos coster != pippenger)\n");
+        }
+
         if (expn <= expn_end_naive) {
             run_result_t<GroupType> result_naive =
                 profile_multiexp<GroupType, FieldType, policies::multiexp_method_naive_plain>(group_elements, scalars);
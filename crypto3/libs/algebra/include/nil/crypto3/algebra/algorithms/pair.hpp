@@ -26,9 +26,12 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -90,6 +93,38 @@ namespace nil {
                 return PairingPolicy::double_miller_loop::process(prec_P1, prec_Q1, prec_P2, prec_Q2);
             }
 
+            /// Product of the Miller loops of prec_P[i] and prec_Q[i], computed in a single loop.
+            /// Supported by the curves whose pairing policy defines multi_miller_loop.
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                  const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+
+                return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q);
+            }
+
+            /// Product of the pairings e(P[i], Q[i]) with one shared final exponentiation.
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            std::optional<typename PairingCurveType::gt_type::value_type>
+                multi_pair_reduced(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                   const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+
+                BOOST_ASSERT(P.size() == Q.size());
+
+                std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                std::vector<typename PairingPolicy::g2_precomputed_type> prec_Q;
+                prec_P.reserve(P.size());
+                prec_Q.reserve(Q.size());
+                for (std::size_t i = 0; i < P.size(); ++i) {
+                    prec_P.push_back(PairingPolicy::precompute_g1::process(P[i]));
+                    prec_Q.push_back(PairingPolicy::precompute_g2::process(Q[i]));
+                }
+
+                typename PairingCurveType::gt_type::value_type f =
+                    PairingPolicy::multi_miller_loop::process(prec_P, prec_Q);
+                return PairingPolicy::final_exponentiation::process(f);
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             std::optional<typename PairingCurveType::gt_type::value_type>
                 final_exponentiation(const typename PairingCurveType::gt_type::value_type &elt) {
@@ -27,12 +27,22 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -54,6 +64,365 @@ namespace nil {
                             return (this->r < other.r);
                         }
                     };
+
+                    template<typename Coordinates>
+                    struct is_jacobian_coordinates : std::false_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian> : std::true_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian_with_a4_0> : std::true_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian_with_a4_minus_3> : std::true_type { };
+
+                    template<typename Coordinates>
+                    struct is_projective_coordinates : std::false_type { };
+                    template<>
+                    struct is_projective_coordinates<curves::coordinates::projective> : std::true_type { };
+                    template<>
+                    struct is_projective_coordinates<curves::coordinates::projective_with_a4_minus_3>
+                        : std::true_type { };
+
+                    /**
+                     * Replaces every non-zero value with its inverse using a single field inversion
+                     * (Montgomery's trick). Zero values are left as they are.
+                     */
+                    template<typename FieldValueType>
+                    void batch_inverse(std::vector<FieldValueType> &values) {
+                        std::vector<FieldValueType> prefix(values.size());
+                        FieldValueType acc = FieldValueType::one();
+                        for (std::size_t i = 0; i < values.size(); ++i) {
+                            prefix[i] = acc;
+                            if (!values[i].is_zero()) {
+                                acc *= values[i];
+                            }
+                        }
+                        acc = acc.inversed();
+                        for (std::size_t i = values.size(); i-- > 0;) {
+                            if (!values[i].is_zero()) {
+                                FieldValueType inverse = acc * prefix[i];
+                                acc *= values[i];
+                                values[i] = inverse;
+                            }
+                        }
+                    }
+
+                    /**
+                     * Runs task(i) for every i in [0, tasks_count) on up to threads_count threads.
+                     * After a task throws no new tasks are started, the first exception is rethrown once all the
+                     * threads are joined.
+                     */
+                    template<typename Task>
+                    void run_tasks(std::size_t tasks_count, std::size_t threads_count, const Task &task) {
+                        threads_count = std::max<std::size_t>(1, std::min(threads_count, tasks_count));
+                        if (threads_count == 1) {
+                            for (std::size_t i = 0; i < tasks_count; ++i) {
+                                task(i);
+                            }
+                            return;
+                        }
+
+                        std::atomic<std::size_t> next_task(0);
+                        std::vector<std::exception_ptr> errors(threads_count);
+                        auto worker = [&](std::size_t thread_index) {
+                            try {
+                                for (std::size_t i = next_task++; i < tasks_count; i = next_task++) {
+                                    task(i);
+                                }
+                            } catch (...) {
+                                errors[thread_index] = std::current_exception();
+                                next_task = tasks_count;
+                            }
+                        };
+                        std::vector<std::thread> threads;
+                        threads.reserve(threads_count - 1);
+                        for (std::size_t i = 1; i < threads_count; ++i) {
+                            threads.emplace_back(worker, i);
+                        }
+                        worker(0);
+                        for (auto &thread : threads) {
+                            thread.join();
+                        }
+                        for (const auto &error : errors) {
+                            if (error) {
+                                std::rethrow_exception(error);
+                            }
+                        }
+                    }
+
+                    /**
+                     * Pippenger's bucket method on short Weierstrass curves, see multiexp_method_pippenger.
+                     */
+                    template<typename BaseValueType>
+                    class pippenger_msm {
+                        using base_value_type = BaseValueType;
+                        using params_type = typename base_value_type::params_type;
+                        using coordinate_type = typename base_value_type::field_type::value_type;
+
+                        struct affine_point {
+                            coordinate_type X;
+                            coordinate_type Y;
+                            bool is_zero;
+                        };
+
+                        // Points which are not worth splitting further
+                        constexpr static const std::size_t min_chunk_size = 1024;
+                        constexpr static const std::size_t max_window = 20;
+
+                    public:
+                        // threads_count is only taken into account for at least min_chunk_size points
+                        template<typename InputBaseIterator, typename InputFieldIterator>
+                        static base_value_type process(InputBaseIterator bases,
+                                                       InputBaseIterator bases_end,
+                                                       InputFieldIterator exponents,
+                                                       InputFieldIterator exponents_end,
+                                                       std::size_t threads_count =
+                                                           std::max(1u, std::thread::hardware_concurrency())) {
+                            typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                            using integral_type = typename field_value_type::integral_type;
+
+                            const std::size_t length = std::distance(bases, bases_end);
+                            BOOST_ASSERT(length == std::size_t(std::distance(exponents, exponents_end)));
+
+                            // Zero terms do not contribute to the result
+                            std::vector<std::size_t> terms;
+                            terms.reserve(length);
+                            for (std::size_t i = 0; i < length; ++i) {
+                                if (!bases[i].is_zero() && !exponents[i].is_zero()) {
+                                    terms.push_back(i);
+                                }
+                            }
+                            const std::size_t n = terms.size();
+                            if (n == 0) {
+                                return base_value_type::zero();
+                            }
+
+                            const std::size_t scalar_bits = field_value_type::field_type::modulus_bits;
+                            if (n < min_chunk_size) {
+                                threads_count = 1;
+                            }
+
+                            // Windows are processed independently, if there are fewer windows than threads the
+                            // points are split into chunks as well.
+                            std::size_t chunks_count = 1;
+                            std::size_t c = window_size(scalar_bits, n);
+                            std::size_t windows_count = scalar_bits / c + 1;
+                            if (windows_count < threads_count) {
+                                chunks_count = std::min((threads_count + windows_count - 1) / windows_count,
+                                                        std::max<std::size_t>(1, n / min_chunk_size));
+                                c = window_size(scalar_bits, (n + chunks_count - 1) / chunks_count);
+                                windows_count = scalar_bits / c + 1;
+                            }
+                            const std::size_t chunk_size = (n + chunks_count - 1) / chunks_count;
+                            chunks_count = (n + chunk_size - 1) / chunk_size;
+
+                            // Affine bases and signed digits of the exponents, digits[k * n + j] is the digit of
+                            // window k of the j-th term.
+                            std::vector<affine_point> points(n);
+                            std::vector<std::int32_t> digits(windows_count * n);
+                            run_tasks(chunks_count, threads_count, [&](std::size_t chunk) {
+                                const std::size_t begin = chunk * chunk_size;
+                                const std::size_t end = std::min(n, begin + chunk_size);
+
+                                to_affine(bases, terms, begin, end, points);
+
+                                for (std::size_t j = begin; j < end; ++j) {
+                                    integral_type exponent(exponents[terms[j]].data);
+                                    std::int32_t carry = 0;
+                                    for (std::size_t k = 0; k < windows_count; ++k) {
+                                        std::int32_t digit = carry;
+                                        for (std::size_t b = 0; b < c && k * c + b < scalar_bits; ++b) {
+                                            if (boost::multiprecision::bit_test(exponent, k * c + b)) {
+                                                digit += std::int32_t(1) << b;
+                                            }
+                                        }
+                                        // Digits are in (-2^(c-1), 2^(c-1)], so only 2^(c-1) buckets are needed
+                                        carry = digit > (std::int32_t(1) << (c - 1)) ? 1 : 0;
+                                        digits[k * n + j] = digit - (carry << c);
+                                    }
+                                    BOOST_ASSERT(carry == 0);
+                                }
+                            });
+
+                            std::vector<base_value_type> partial_sums(windows_count * chunks_count);
+                            run_tasks(windows_count * chunks_count, threads_count, [&](std::size_t task) {
+                                const std::size_t k = task / chunks_count;
+                                const std::size_t begin = (task % chunks_count) * chunk_size;
+                                const std::size_t end = std::min(n, begin + chunk_size);
+                                partial_sums[task] = window_sum(points, digits.data() + k * n, begin, end, c);
+                            });
+
+                            base_value_type result = base_value_type::zero();
+                            for (std::size_t k = windows_count; k-- > 0;) {
+                                for (std::size_t i = 0; i < c; ++i) {
+                                    result.double_inplace();
+                                }
+                                for (std::size_t chunk = 0; chunk < chunks_count; ++chunk) {
+                                    result += partial_sums[k * chunks_count + chunk];
+                                }
+                            }
+                            return result;
+                        }
+
+                    private:
+                        // Window size minimizing the number of bucket additions plus running sum additions,
+                        // the latter are projective and cost about twice as much.
+                        static std::size_t window_size(std::size_t scalar_bits, std::size_t points_count) {
+                            std::size_t best = 1;
+                            std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+                            for (std::size_t c = 1; c <= max_window; ++c) {
+                                std::size_t cost = (scalar_bits / c + 1) * (points_count + (std::size_t(1) << (c + 1)));
+                                if (cost < best_cost) {
+                                    best = c;
+                                    best_cost = cost;
+                                }
+                            }
+                            return best;
+                        }
+
+                        template<typename InputBaseIterator>
+                        static void to_affine(InputBaseIterator bases,
+                                              const std::vector<std::size_t> &terms,
+                                              std::size_t begin,
+                                              std::size_t end,
+                                              std::vector<affine_point> &points) {
+                            std::vector<coordinate_type> z_inverses(end - begin);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                z_inverses[j - begin] = bases[terms[j]].Z;
+                            }
+                            batch_inverse(z_inverses);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                const auto &base = bases[terms[j]];
+                                const coordinate_type &z_inverse = z_inverses[j - begin];
+                                if (is_jacobian_coordinates<typename base_value_type::coordinates>::value) {
+                                    coordinate_type z_inverse_squared = z_inverse.squared();
+                                    points[j] = {base.X * z_inverse_squared, base.Y * z_inverse_squared * z_inverse,
+                                                 false};
+                                } else {
+                                    points[j] = {base.X * z_inverse, base.Y * z_inverse, false};
+                                }
+                            }
+                        }
+
+                        /**
+                         * Sum of digit * point over the points in [begin, end), for one window.
+                         * Points are sorted into buckets by the absolute value of the digit, then the points of
+                         * every bucket are added up pairwise in affine coordinates. All the additions of one round
+                         * share one inversion.
+                         */
+                        static base_value_type window_sum(const std::vector<affine_point> &points,
+                                                          const std::int32_t *digits,
+                                                          std::size_t begin,
+                                                          std::size_t end,
+                                                          std::size_t c) {
+                            const std::size_t buckets_count = std::size_t(1) << (c - 1);
+
+                            std::vector<std::size_t> bucket_begin(buckets_count + 1, 0);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                if (digits[j] != 0) {
+                                    ++bucket_begin[std::abs(digits[j])];
+                                }
+                            }
+                            for (std::size_t b = 1; b <= buckets_count; ++b) {
+                                bucket_begin[b] += bucket_begin[b - 1];
+                            }
+
+                            // Bucket b - 1 takes the points with digit +-b, it starts at bucket_begin[b - 1]
+                            std::vector<affine_point> sorted(bucket_begin[buckets_count]);
+                            std::vector<std::size_t> position(bucket_begin.begin(), bucket_begin.end() - 1);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                if (digits[j] != 0) {
+                                    affine_point &point = sorted[position[std::abs(digits[j]) - 1]++];
+                                    point = points[j];
+                                    if (digits[j] < 0) {
+                                        point.Y = -point.Y;
+                                    }
+                                }
+                            }
+
+                            std::vector<std::size_t> bucket_size(buckets_count);
+                            for (std::size_t b = 0; b < buckets_count; ++b) {
+                                bucket_size[b] = bucket_begin[b + 1] - bucket_begin[b];
+                            }
+
+                            std::vector<coordinate_type> denominators;
+                            bool reduced = false;
+                            while (!reduced) {
+                                reduced = true;
+                                denominators.clear();
+                                for (std::size_t b = 0; b < buckets_count; ++b) {
+                                    const affine_point *bucket = sorted.data() + bucket_begin[b];
+                                    for (std::size_t i = 0; i + 1 < bucket_size[b]; i += 2) {
+                                        denominators.push_back(addition_denominator(bucket[i], bucket[i + 1]));
+                                    }
+                                    reduced = reduced && bucket_size[b] <= 1;
+                                }
+                                if (reduced) {
+                                    break;
+                                }
+
+                                batch_inverse(denominators);
+
+                                std::size_t pair = 0;
+                                for (std::size_t b = 0; b < buckets_count; ++b) {
+                                    affine_point *bucket = sorted.data() + bucket_begin[b];
+                                    const std::size_t size = bucket_size[b];
+                                    for (std::size_t i = 0; i + 1 < size; i += 2) {
+                                        bucket[i / 2] = add(bucket[i], bucket[i + 1], denominators[pair++]);
+                                    }
+                                    if (size % 2 == 1) {
+                                        bucket[size / 2] = bucket[size - 1];
+                                    }
+                                    bucket_size[b] = (size + 1) / 2;
+                                }
+                            }
+
+                            // sum_b (b + 1) * bucket_b = sum_b sum_{i >= b} bucket_i
+                            base_value_type running_sum = base_value_type::zero();
+                            base_value_type result = base_value_type::zero();
+                            for (std::size_t b = buckets_count; b-- > 0;) {
+                                if (bucket_size[b] != 0 && !sorted[bucket_begin[b]].is_zero) {
+                                    const affine_point &point = sorted[bucket_begin[b]];
+                                    running_sum += base_value_type(point.X, point.Y, coordinate_type::one());
+                                }
+                                result += running_sum;
+                            }
+                            return result;
+                        }
+
+                        // Denominator of the slope of p + q, zero if no inversion is needed
+                        static coordinate_type addition_denominator(const affine_point &p, const affine_point &q) {
+                            if (p.is_zero || q.is_zero) {
+                                return coordinate_type::zero();
+                            }
+                            if (p.X != q.X) {
+                                return q.X - p.X;
+                            }
+                            if (p.Y == q.Y) {
+                                // Zero for a point of order 2, then p + q is zero
+                                return p.Y.doubled();
+                            }
+                            return coordinate_type::zero();
+                        }
+
+                        static affine_point add(const affine_point &p, const affine_point &q,
+                                                const coordinate_type &denominator_inverse) {
+                            if (p.is_zero) {
+                                return q;
+                            }
+                            if (q.is_zero) {
+                                return p;
+                            }
+                            if (denominator_inverse.is_zero()) {
+                                return {coordinate_type::zero(), coordinate_type::zero(), true};
+                            }
+                            coordinate_type slope = (p.X != q.X) ?
+                                (q.Y - p.Y) * denominator_inverse :
+                                (3u * p.X.squared() + params_type::a) * denominator_inverse;
+                            coordinate_type X = slope.squared() - p.X - q.X;
+                            coordinate_type Y = slope * (p.X - X) - p.Y;
+                            return {X, Y, false};
+                        }
+                    };
                 }    // namespace detail
 
                 /**
@@ -319,6 +688,59 @@ namespace nil {
                         return opt_result;
                     }
                 };
+                /**
+                 * Pippenger's bucket method with signed digit windows.
+                 * Bases are converted to affine coordinates, the points of a bucket are added pairwise in affine
+                 * coordinates with one shared inversion per round of additions. The work is split between threads
+                 * by window and, when there are fewer windows than threads, by range of points.
+                 * The window size is chosen from the number of points. Curves other than short Weierstrass in
+                 * jacobian or projective coordinates fall back to multiexp_method_BDLO12.
+                 */
+                struct multiexp_method_pippenger {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                        return process_impl(bases, bases_end, exponents, exponents_end,
+                                            std::integral_constant<bool, is_supported<base_value_type>::value>());
+                    }
+
+                private:
+                    template<typename BaseValueType>
+                    struct is_supported
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<typename BaseValueType::form, curves::forms::short_weierstrass>::value &&
+                                  (detail::is_jacobian_coordinates<typename BaseValueType::coordinates>::value ||
+                                   detail::is_projective_coordinates<typename BaseValueType::coordinates>::value)> {
+                    };
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_impl(InputBaseIterator bases,
+                                     InputBaseIterator bases_end,
+                                     InputFieldIterator exponents,
+                                     InputFieldIterator exponents_end,
+                                     std::true_type) {
+                        return detail::pippenger_msm<typename std::iterator_traits<InputBaseIterator>::value_type>::
+                            process(bases, bases_end, exponents, exponents_end);
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_impl(InputBaseIterator bases,
+                                     InputBaseIterator bases_end,
+                                     InputFieldIterator exponents,
+                                     InputFieldIterator exponents_end,
+                                     std::false_type) {
+                        return multiexp_method_BDLO12::process(bases, bases_end, exponents, exponents_end);
+                    }
+                };
             }    // namespace policies
         }        // namespace algebra
     }            // namespace crypto3
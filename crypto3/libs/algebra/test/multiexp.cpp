@@ -87,11 +87,96 @@ class multiexp_runner {
                 points.begin(), points.end(),
                 scalars.begin(), scalars.end());
 
+        point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
 
         BOOST_CHECK_EQUAL(naive_result, bdlo12_result);
         BOOST_CHECK_EQUAL(naive_result, bos_coster_result);
+        BOOST_CHECK_EQUAL(naive_result, pippenger_result);
 
-        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result);
+        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result) &&
+               (naive_result == pippenger_result);
+    }
+
+    // Enough points for Pippenger to run on several threads. With 64 threads there are fewer windows than
+    // threads, so the points are split into chunks as well.
+    bool static run_large() {
+        using point = typename curve_group_type::value_type;
+        using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+        std::size_t N = 4096;
+
+        std::vector<point> points(N);
+        std::vector<typename scalar::value_type> scalars(N);
+
+        for(auto & p: points) {
+            p = random_element<curve_group_type>();
+        }
+
+        for(auto & s: scalars) {
+            s = random_element<scalar>();
+        }
+
+        return check_pippenger(points, scalars);
+    }
+
+    // Zero bases and zero scalars, equal terms which end up doubled in the buckets and terms with negated bases
+    // which add up to zero there.
+    bool static run_special_terms(std::size_t N) {
+        using point = typename curve_group_type::value_type;
+        using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+        const point base = random_element<curve_group_type>();
+        const typename scalar::value_type exponent = random_element<scalar>();
+
+        std::vector<point> points;
+        std::vector<typename scalar::value_type> scalars;
+        for(std::size_t i = 0; points.size() < N; ++i) {
+            switch (i % 5) {
+                case 0:
+                case 1:
+                    points.push_back(base);
+                    scalars.push_back(exponent);
+                    break;
+                case 2:
+                    points.push_back(-base);
+                    scalars.push_back(exponent);
+                    break;
+                case 3:
+                    points.push_back(point::zero());
+                    scalars.push_back(random_element<scalar>());
+                    break;
+                default:
+                    points.push_back(random_element<curve_group_type>());
+                    scalars.push_back(scalar::value_type::zero());
+                    break;
+            }
+        }
+
+        return check_pippenger(points, scalars);
+    }
+
+    private:
+    template<typename Point, typename Scalar>
+    bool static check_pippenger(const std::vector<Point> &points, const std::vector<Scalar> &scalars) {
+        Point naive_result = policies::multiexp_method_naive_plain::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        Point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        Point chunked_pippenger_result = policies::detail::pippenger_msm<Point>::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end(), 64);
+
+        BOOST_CHECK_EQUAL(naive_result, pippenger_result);
+        BOOST_CHECK_EQUAL(naive_result, chunked_pippenger_result);
+
+        return (naive_result == pippenger_result) && (naive_result == chunked_pippenger_result);
     }
 };
 
@@ -112,8 +197,26 @@ using multiexp_runners = boost::mpl::list<
     multiexp_runner<curves::mnt6_298::template g2_type<>>
     >;
 
+using multiexp_large_runners = boost::mpl::list<
+    multiexp_runner<curves::alt_bn128_254::template g1_type<>>,
+
+    multiexp_runner<curves::bls12_381::template g1_type<>>,
+    multiexp_runner<curves::bls12_381::template g2_type<>>,
+
+    multiexp_runner<curves::mnt4_298::template g1_type<>>
+    >;
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_test, runner, multiexp_runners) {
     BOOST_CHECK(runner::run());
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_special_terms_test, runner, multiexp_runners) {
+    BOOST_CHECK(runner::run_special_terms(100));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_large_test, runner, multiexp_large_runners) {
+    BOOST_CHECK(runner::run_large());
+    BOOST_CHECK(runner::run_special_terms(4096));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -620,6 +620,40 @@ void pairing_operation_test(const TestSet &test_set) {
                                        G2_prec_elements);
 }
 
+template<typename CurveType, typename TestSet>
+void multi_miller_loop_test(const TestSet &test_set) {
+    std::vector<typename CurveType::scalar_field_type::value_type> Fr_elements;
+    std::vector<typename CurveType::template g1_type<>::value_type> G1_elements;
+    std::vector<typename CurveType::template g2_type<>::value_type> G2_elements;
+    std::vector<typename CurveType::gt_type::value_type> GT_elements;
+    std::vector<typename pairing::pairing_policy<CurveType>::g1_precomputed_type> G1_prec_elements;
+    std::vector<typename pairing::pairing_policy<CurveType>::g2_precomputed_type> G2_prec_elements;
+
+    pairing_test_init<CurveType>(Fr_elements, G1_elements, G2_elements, GT_elements, G1_prec_elements, G2_prec_elements,
+                                test_set);
+
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>({}, {}), CurveType::gt_type::value_type::one());
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>({G1_prec_elements[prec_A1]}, {G2_prec_elements[prec_B1]}),
+                      GT_elements[miller_loop_prec_A1_prec_B1]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>({G1_prec_elements[prec_A1], G1_prec_elements[prec_A2]},
+                                                   {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2]}),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(
+                          {G1_prec_elements[prec_A1], G1_prec_elements[prec_A2], G1_prec_elements[prec_A1]},
+                          {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2], G2_prec_elements[prec_B2]}),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2] *
+                          miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B2]));
+
+    auto reduced = multi_pair_reduced<CurveType>({G1_elements[A1], G1_elements[A2]}, {G2_elements[B1], G2_elements[B2]});
+    BOOST_CHECK(reduced);
+    BOOST_CHECK_EQUAL(*reduced, GT_elements[pair_reduceding_A1_B1_mul_pair_reduceding_A2_B2]);
+
+    // e(A1, B1) * e(-A1, B1) == 1
+    reduced = multi_pair_reduced<CurveType>({G1_elements[A1], -G1_elements[A1]}, {G2_elements[B1], G2_elements[B1]});
+    BOOST_CHECK(reduced);
+    BOOST_CHECK_EQUAL(*reduced, CurveType::gt_type::value_type::one());
+}
+
 BOOST_AUTO_TEST_SUITE(pairing_manual_tests)
 
 BOOST_DATA_TEST_CASE(pairing_operation_test_bls12_381, string_data("pairing_operation_test_bls12_381"), data_set) {
@@ -646,4 +680,16 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_alt_bn128, string_data("pairing_oper
     pairing_operation_test<curve_type>(data_set);
 }
 
+BOOST_DATA_TEST_CASE(multi_miller_loop_test_bls12_381, string_data("pairing_operation_test_bls12_381"), data_set) {
+    using curve_type = typename curves::bls12<381>;
+
+    multi_miller_loop_test<curve_type>(data_set);
+}
+
+BOOST_DATA_TEST_CASE(multi_miller_loop_test_alt_bn128, string_data("pairing_operation_test_alt_bn128_254"), data_set) {
+    using curve_type = typename curves::alt_bn128<254>;
+
+    multi_miller_loop_test<curve_type>(data_set);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
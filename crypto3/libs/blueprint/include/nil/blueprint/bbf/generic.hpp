@@ -266,6 +266,17 @@ namespace nil {
                     return res;
                 }
 
+                // Grows the witness columns of the context to hold the first rows_amount rows. After that cells
+                // in disjoint rows of these columns can be assigned from different threads.
+                void reserve_rows(std::size_t rows_amount) {
+                    if (rows_amount == 0) {
+                        return;
+                    }
+                    for (std::size_t col : col_map[column_type::witness]) {
+                        at.witness(col, get_row(rows_amount - 1));
+                    }
+                }
+
                 private:
                     // reference to the actual assignment table
                     assignment_type &at;
@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLUEPRINT_UTILS_PARALLEL_FOR_HPP
+#define CRYPTO3_BLUEPRINT_UTILS_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace blueprint {
+        inline std::size_t hardware_threads_amount() {
+            return std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        /*
+         * Calls f(i) for every i in [0, amount) on at most threads_amount threads, the calling thread is one of them.
+         * Indices are handed out one at a time, so uneven items balance out. After an exception no new indices are
+         * handed out, and the first exception is rethrown once all the threads are joined.
+         *
+         * Blueprint does not depend on the parallel crypto3 thread pool, and this is also used by the single-threaded
+         * builds of its users, so the workers are plain std::threads.
+         */
+        template<typename Function>
+        void parallel_for(std::size_t amount, Function f, std::size_t threads_amount = hardware_threads_amount()) {
+            threads_amount = std::min(threads_amount, amount);
+            if (threads_amount <= 1) {
+                for (std::size_t i = 0; i < amount; ++i) {
+                    f(i);
+                }
+                return;
+            }
+
+            std::atomic<std::size_t> next(0);
+            std::vector<std::exception_ptr> errors(threads_amount);
+            auto worker = [&](std::size_t t) {
+                try {
+                    for (std::size_t i = next++; i < amount; i = next++) {
+                        f(i);
+                    }
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                    next = amount;
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (std::size_t t = 1; t < threads_amount; ++t) {
+                threads.emplace_back(worker, t);
+            }
+            worker(0);
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            for (const auto &error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        /*
+         * Splits [0, size) into chunks_amount contiguous chunks of nearly equal sizes and calls
+         * f(chunk, begin, end) for each of them in parallel.
+         */
+        template<typename Function>
+        void parallel_for_chunks(std::size_t chunks_amount, std::size_t size, Function f) {
+            auto chunk_begin = [chunks_amount, size](std::size_t chunk) {
+                return size / chunks_amount * chunk + std::min(chunk, size % chunks_amount);
+            };
+            parallel_for(chunks_amount, [&](std::size_t chunk) {
+                f(chunk, chunk_begin(chunk), chunk_begin(chunk + 1));
+            }, chunks_amount);
+        }
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // CRYPTO3_BLUEPRINT_UTILS_PARALLEL_FOR_HPP
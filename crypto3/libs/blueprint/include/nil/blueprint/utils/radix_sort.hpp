@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLUEPRINT_UTILS_RADIX_SORT_HPP
+#define CRYPTO3_BLUEPRINT_UTILS_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/blueprint/utils/parallel_for.hpp>
+
+namespace nil {
+    namespace blueprint {
+        /*
+         * Fixed-width sort key of an object, compared bytewise. The objects themselves stay in place while the keys
+         * are sorted, index is the position of the object the key was made for.
+         */
+        template<std::size_t KeySize>
+        struct packed_sort_key {
+            std::array<std::uint8_t, KeySize> bytes;
+            std::uint32_t index;
+        };
+
+        namespace detail {
+            // Ranges smaller than this are not worth a thread.
+            constexpr std::size_t radix_sort_min_chunk_size = 1 << 15;
+
+            inline std::size_t radix_sort_chunks_amount(std::size_t size) {
+                return std::max<std::size_t>(1, std::min(hardware_threads_amount(), size / radix_sort_min_chunk_size));
+            }
+        }    // namespace detail
+
+        /*
+         * Stable LSD radix sort, one byte per pass, with every pass split between threads. Byte positions which hold
+         * the same value in all the keys are skipped, so keys with wide but mostly constant fields are cheap to sort.
+         */
+        template<std::size_t KeySize>
+        void radix_sort(std::vector<packed_sort_key<KeySize>> &keys) {
+            const std::size_t size = keys.size();
+            if (size < 2) {
+                return;
+            }
+            const std::size_t chunks_amount = detail::radix_sort_chunks_amount(size);
+
+            std::vector<std::array<bool, KeySize>> varying(chunks_amount);
+            parallel_for_chunks(chunks_amount, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                std::array<bool, KeySize> &chunk_varying = varying[chunk];
+                chunk_varying.fill(false);
+                for (std::size_t i = begin; i < end; ++i) {
+                    for (std::size_t j = 0; j < KeySize; ++j) {
+                        chunk_varying[j] |= keys[i].bytes[j] != keys[0].bytes[j];
+                    }
+                }
+            });
+
+            std::vector<packed_sort_key<KeySize>> buffer(size);
+            std::vector<std::array<std::size_t, 256>> offsets(chunks_amount);
+            for (std::size_t position = KeySize; position-- > 0;) {
+                if (std::none_of(varying.begin(), varying.end(), [position](const std::array<bool, KeySize> &v) {
+                        return v[position];
+                    })) {
+                    continue;
+                }
+
+                parallel_for_chunks(chunks_amount, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    std::array<std::size_t, 256> &counts = offsets[chunk];
+                    counts.fill(0);
+                    for (std::size_t i = begin; i < end; ++i) {
+                        ++counts[keys[i].bytes[position]];
+                    }
+                });
+
+                // Keys with the same byte keep their order: earlier chunks go first.
+                std::size_t offset = 0;
+                for (std::size_t digit = 0; digit < 256; ++digit) {
+                    for (std::size_t chunk = 0; chunk < chunks_amount; ++chunk) {
+                        const std::size_t count = offsets[chunk][digit];
+                        offsets[chunk][digit] = offset;
+                        offset += count;
+                    }
+                }
+
+                parallel_for_chunks(chunks_amount, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    std::array<std::size_t, 256> &chunk_offsets = offsets[chunk];
+                    for (std::size_t i = begin; i < end; ++i) {
+                        buffer[chunk_offsets[keys[i].bytes[position]]++] = keys[i];
+                    }
+                });
+                keys.swap(buffer);
+            }
+        }
+
+        /*
+         * Stable sort of objects by the keys pack(object, key_bytes) writes. Only the keys are moved while sorting,
+         * every object is moved once, to its final place.
+         */
+        template<std::size_t KeySize, typename T, typename PackFunction>
+        void sort_by_packed_key(std::vector<T> &objects, PackFunction pack) {
+            const std::size_t size = objects.size();
+            BOOST_ASSERT(size <= std::numeric_limits<std::uint32_t>::max());
+            if (size < 2) {
+                return;
+            }
+            const std::size_t chunks_amount = detail::radix_sort_chunks_amount(size);
+
+            std::vector<packed_sort_key<KeySize>> keys(size);
+            parallel_for_chunks(chunks_amount, size, [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    pack(objects[i], keys[i].bytes.data());
+                    keys[i].index = static_cast<std::uint32_t>(i);
+                }
+            });
+
+            radix_sort(keys);
+
+            std::vector<T> sorted(size);
+            parallel_for_chunks(chunks_amount, size, [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    sorted[i] = std::move(objects[keys[i].index]);
+                }
+            });
+            objects.swap(sorted);
+        }
+
+        // Writes the bytes_amount lowest bytes of value, most significant first.
+        inline void pack_big_endian(std::uint64_t value, std::size_t bytes_amount, std::uint8_t *out) {
+            for (std::size_t i = bytes_amount; i-- > 0;) {
+                out[i] = static_cast<std::uint8_t>(value);
+                value >>= 8;
+            }
+        }
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    // CRYPTO3_BLUEPRINT_UTILS_RADIX_SORT_HPP
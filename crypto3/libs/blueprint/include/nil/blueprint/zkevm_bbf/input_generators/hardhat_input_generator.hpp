@@ -23,6 +23,11 @@
 //---------------------------------------------------------------------------//
 
 #pragma once
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -36,11 +41,112 @@
 #include <nil/blueprint/zkevm_bbf/types/zkevm_state.hpp>
 
 #include <nil/blueprint/zkevm_bbf/types/zkevm_input_generator.hpp>
+#include <nil/blueprint/zkevm_bbf/input_generators/hardhat_trace_reader.hpp>
 #include <nil/blueprint/zkevm_bbf/opcodes/zkevm_opcodes.hpp>
 
 namespace nil {
     namespace blueprint {
         namespace bbf {
+            // How an opcode of a hardhat trace turns into RW operations. Stack depths are counted from the top, the top
+            // is 1. Stack reads go first, then memory or storage operations of the opcode, then stack writes.
+            struct hardhat_opcode_rw{
+                enum class memory_effect{
+                    none, keccak, calldatacopy, mload, mstore, mstore8, sload, sstore, return_data
+                };
+
+                bool                                             known = false;
+                bool                                             implemented = true;
+                std::vector<std::pair<std::size_t, std::size_t>> stack_reads;  // (address depth, value depth) before opcode
+                std::vector<std::size_t>                         stack_writes; // depths after opcode
+                memory_effect                                    effect = memory_effect::none;
+                bool                                             exponentiation = false;
+            };
+
+            inline const std::array<hardhat_opcode_rw, 256> &hardhat_opcode_rw_table(){
+                static const std::array<hardhat_opcode_rw, 256> table = [](){
+                    using effect = hardhat_opcode_rw::memory_effect;
+                    std::array<hardhat_opcode_rw, 256> t;
+                    // Reads top reads_amount elements, writes the top one
+                    auto op = [&t](std::size_t opcode, std::size_t reads_amount, bool write, effect e = effect::none){
+                        t[opcode].known = true;
+                        for( std::size_t i = 1; i <= reads_amount; i++ ) t[opcode].stack_reads.push_back({i, i});
+                        if( write ) t[opcode].stack_writes.push_back(1);
+                        t[opcode].effect = e;
+                    };
+                    // Same, but addresses of the read elements go in the reverse order
+                    auto mirrored = [&t](std::size_t opcode, std::size_t reads_amount, bool write){
+                        t[opcode].known = true;
+                        for( std::size_t i = 1; i <= reads_amount; i++ ) t[opcode].stack_reads.push_back({reads_amount + 1 - i, i});
+                        if( write ) t[opcode].stack_writes.push_back(1);
+                    };
+                    auto not_implemented = [&t](std::size_t opcode){
+                        t[opcode].known = true;
+                        t[opcode].implemented = false;
+                    };
+
+                    op(0x00, 0, false);                                         // STOP
+                    for( std::size_t o = 0x01; o <= 0x07; o++ ) op(o, 2, true); // ADD ... SMOD
+                    op(0x08, 3, true);                                          // ADDMOD
+                    op(0x09, 3, true);                                          // MULMOD
+                    op(0x0a, 2, true);                                          // EXP
+                    t[0x0a].exponentiation = true;
+                    op(0x0b, 2, true);                                          // SIGNEXTEND
+                    for( std::size_t o = 0x10; o <= 0x14; o++ ) op(o, 2, true); // LT, GT, SLT, SGT, EQ
+                    op(0x15, 1, true);                                          // ISZERO
+                    for( std::size_t o = 0x16; o <= 0x18; o++ ) op(o, 2, true); // AND, OR, XOR
+                    op(0x19, 1, true);                                          // NOT
+                    for( std::size_t o = 0x1a; o <= 0x1d; o++ ) op(o, 2, true); // BYTE, SHL, SHR, SAR
+                    op(0x20, 2, true, effect::keccak);                          // KECCAK256
+                    op(0x30, 0, true);                                          // ADDRESS
+                    op(0x31, 1, true);                                          // BALANCE TODO: add read operations from account
+                    op(0x32, 0, true);                                          // ORIGIN
+                    op(0x33, 0, true);                                          // CALLER
+                    op(0x34, 0, true);                                          // CALLVALUE
+                    op(0x35, 1, true);                                          // CALLDATALOAD TODO: add 32 read operations to calldata
+                    op(0x36, 0, true);                                          // CALLDATASIZE TODO: get real call data size
+                    op(0x37, 3, false, effect::calldatacopy);                   // CALLDATACOPY
+                    for( std::size_t o = 0x38; o <= 0x4a; o++ ) not_implemented(o); // CODESIZE ... BLOBBASEFEE
+                    op(0x50, 0, false);                                         // POP
+                    op(0x51, 1, true, effect::mload);                           // MLOAD
+                    op(0x52, 2, false, effect::mstore);                         // MSTORE
+                    op(0x53, 2, false, effect::mstore8);                        // MSTORE8
+                    op(0x54, 1, true, effect::sload);                           // SLOAD
+                    op(0x55, 2, false, effect::sstore);                         // SSTORE
+                    op(0x56, 1, false);                                         // JUMP
+                    op(0x57, 2, false);                                         // JUMPI
+                    op(0x58, 0, true);                                          // PC
+                    op(0x59, 0, true);                                          // MSIZE
+                    op(0x5a, 0, true);                                          // GAS
+                    op(0x5b, 0, false);                                         // JUMPDEST
+                    for( std::size_t o = 0x5c; o <= 0x5e; o++ ) not_implemented(o); // TLOAD, TSTORE, MCOPY
+                    for( std::size_t o = 0x5f; o <= 0x7f; o++ ) op(o, 0, true); // PUSH0 ... PUSH32
+                    for( std::size_t n = 1; n <= 16; n++ ){
+                        t[0x7f + n].known = true;                               // DUPn
+                        t[0x7f + n].stack_reads = {{n, n}};
+                        t[0x7f + n].stack_writes = {1};
+                        t[0x8f + n].known = true;                               // SWAPn
+                        t[0x8f + n].stack_reads = {{1, 1}, {n + 1, n + 1}};
+                        t[0x8f + n].stack_writes = {n + 1, 1};
+                    }
+                    op(0xa0, 2, false);                                         // LOG0
+                    op(0xa1, 3, false);                                         // LOG1
+                    op(0xa2, 4, false);                                         // LOG2
+                    mirrored(0xa3, 5, false);                                   // LOG3
+                    mirrored(0xa4, 6, false);                                   // LOG4
+                    mirrored(0xf0, 3, true);                                    // CREATE
+                    mirrored(0xf1, 7, true);                                    // CALL
+                    mirrored(0xf2, 7, true);                                    // CALLCODE
+                    op(0xf3, 2, false, effect::return_data);                    // RETURN
+                    mirrored(0xf4, 6, true);                                    // DELEGATECALL
+                    mirrored(0xf5, 4, true);                                    // CREATE2
+                    mirrored(0xfa, 6, true);                                    // STATICCALL
+                    mirrored(0xfd, 2, false);                                   // REVERT
+                    op(0xff, 1, false);                                         // SELFDESTRUCT
+                    return t;
+                }();
+                return table;
+            }
+
             class zkevm_hardhat_input_generator:zkevm_abstract_input_generator{
             public:
                 zkevm_hardhat_input_generator(
@@ -51,928 +157,272 @@ namespace nil {
                         _keccaks.new_buffer(bytecode);
                         _bytecodes.new_buffer(bytecode);
                     }
+                    _bytecodes.finalize();
 
                     std::size_t call_id = 0;
                     std::size_t rw_counter = 0;
                     //_rw_operations.push_back(start_rw_operation());
                     for( auto &pt: pts){
-                        boost::property_tree::ptree ptrace = pt.get_child("result.structLogs");
-                        std::cout << "PT = " << ptrace.size() << std::endl;
-
-                        std::vector<zkevm_word_type> stack = zkevm_word_vector_from_ptree(ptrace.begin()->second.get_child("stack"));
-                        std::vector<std::uint8_t> memory = byte_vector_from_ptree(ptrace.begin()->second.get_child("memory"));
-                        std::vector<std::uint8_t> memory_next;
-                        std::vector<zkevm_word_type> stack_next;
-                        std::map<zkevm_word_type, zkevm_word_type> storage = key_value_storage_from_ptree(ptrace.begin()->second.get_child("storage"));
-                        std::map<zkevm_word_type, zkevm_word_type> storage_next;
-
-                        std::size_t memory_size_before = 0;
-                        for( auto it = ptrace.begin(); it!=ptrace.end(); it++){
-                            std::string opcode = it->second.get_child("op").data();
-                            //std::cout << "\t" << opcode << std::endl;
-                            if(std::distance(it, ptrace.end()) != 1){
-                                stack_next = zkevm_word_vector_from_ptree(std::next(it)->second.get_child("stack"));
-                                memory_next = byte_vector_from_ptree(std::next(it)->second.get_child("memory"));
-                                storage_next = key_value_storage_from_ptree(it->second.get_child("storage"));
-                            }
-                            using integral_type = boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<257>>;
-
-                            zkevm_state state; // TODO:optimize
-                            state.tx_hash = 0;  // TODO: change it
-                            state.opcode = opcode_number_from_str(opcode);
-                            state.call_id = call_id;
-                            state.gas = atoi(it->second.get_child("gas").data().c_str());
-                            state.pc = atoi(it->second.get_child("pc").data().c_str());
-                            state.rw_counter = rw_counter;
-                            state.bytecode_hash = _bytecodes.get_data()[0].second; // TODO: fix it if possible
-                            state.additional_input = opcode.substr(0,4) == "PUSH"? stack_next[stack_next.size() - 1]: 0;
-                            state.tx_finish = (std::distance(it, ptrace.end()) != 1);
-                            state.stack_size = stack.size();
-                            state.memory_size = memory_size_before;
-                            state.stack_slice = stack;
-                            // TODO:memory_slice
-                            // TODO:storage_slice
-                            for( std::size_t i = 0; i < memory.size(); i++){
-                                state.memory_slice[i] = memory[i];
-                            }
-                            // Opcode is not presented in RW lookup table. We just take it from json
-                            // // std::cout << opcode << std::endl;
-                            memory_size_before = memory.size();
-                            if(opcode == "STOP") {
-                                // 0x00 -- no RW operations
-                            } else if(opcode == "ADD") {
-                                // 0x01
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "MUL") {
-                                // 0x02
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SUB") {
-                                // 0x03
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DIV") {
-                                // 0x04
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SDIV") {
-                                // 0x05
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            }  else if(opcode == "MOD") {
-                                // 0x06
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            }   else if(opcode == "SMOD") {
-                                // 0x07
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "ADDMOD") {
-                                // 0x08
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "MULMOD") {
-                                // 0x09
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            }   else if(opcode == "EXP") {
-                                // 0x0a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                                _exponentiations.push_back({stack[stack.size() - 1], stack[stack.size() - 2]});
-                            }   else if(opcode == "SIGEXTEND") {
-                                // 0x0b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "LT") {
-                                // 0x10
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "GT") {
-                                // 0x11
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SLT") {
-                                // 0x12
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SGT") {
-                                // 0x13
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "EQ") {
-                                // 0x14
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "ISZERO") {
-                                // 0x15
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "AND") {
-                                // 0x16
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "OR") {
-                                // 0x17
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "XOR") {
-                                // 0x18
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "NOT") {
-                                // 0x19
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "BYTE") {
-                                // 0x1a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SHL") {
-                                // 0x1b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SHR") {
-                                // 0x1c
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SAR") {
-                                // 0x1d
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "KECCAK256") {
-                                // 0x20
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-
-                                std::size_t length = std::size_t(integral_type(stack[stack.size()-2]));
-                                std::size_t  offset = std::size_t(integral_type(stack[stack.size()-1]));
-                                auto hash_value = stack_next[stack_next.size()-1];
-
-                                std::cout << "\tAdd copy event for KECCAK256 length = " << length << std::endl;
-                                copy_event cpy;
-                                cpy.source_id = call_id;
-                                cpy.source_type = copy_operand_type::memory;
-                                cpy.src_address = offset;
-                                cpy.destination_id = hash_value;
-                                cpy.destination_type = copy_operand_type::keccak;
-                                cpy.dst_address = 0;
-                                cpy.length = length;
-                                cpy.initial_rw_counter = rw_counter;
-                                cpy.bytes = {};
-                                std::cout << "\toffset = " << offset << std::endl;
-
-                                std::size_t offset_small = w_to_16(offset)[15];
-                                for( std::size_t i = 0; i < length; i++){
-                                    _rw_operations.push_back(memory_rw_operation(call_id, offset+i, rw_counter++, false, memory_next[offset_small + i]));
-                                    cpy.bytes.push_back(memory_next[offset_small + i]);
-                                }
-                                _copy_events.push_back(cpy);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, hash_value));
-                                _keccaks.new_buffer(cpy.bytes);
-                                memory_size_before = memory_next.size();
-                            } else if(opcode == "ADDRESS") {
-                                // 0x30
-                                std::cout << "Test ADDRESS opcode, please!" << std::endl;
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "BALANCE") {
-                                // 0x31
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "Test BALANCE opcode, please!" << std::endl;
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-
-                                // TODO:  add read operations from account
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "ORIGIN") {
-                                // 0x32
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "Test ORIGIN opcode, please!" << std::endl;
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CALLER") {
-                                // 0x33
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "Test CALLER opcode, please!" << std::endl;
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CALLVALUE") {
-                                // 0x34
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CALLDATALOAD") {
-                                // 0x35
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-
-                                // TODO: add 32 read operations to calldata
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CALLDATASIZE") {
-                                // 0x36
-                                // TODO: get real call data size
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CALLDATACOPY") {
-                                // 0x37
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-
-                                std::size_t length = std::size_t(integral_type(stack[stack.size()-3]));
-                                std::size_t src = std::size_t(integral_type(stack[stack.size()-2]));
-                                std::size_t dest = std::size_t(integral_type(stack[stack.size()-1]));
-                                // std::cout << "Length = " << length << std::endl;
-                                // std::cout << "Memory_size " << memory.size() << "=>" << memory_next.size() << std::endl;
-
-                                std::cout << "\tAdd copy event for CALLDATACOPY length = " << length << std::endl;
-                                copy_event cpy;
-                                cpy.source_id = call_id;
-                                cpy.source_type = copy_operand_type::calldata;
-                                cpy.src_address = src;
-                                cpy.destination_id = call_id;
-                                cpy.destination_type = copy_operand_type::memory;
-                                cpy.dst_address = dest;
-                                cpy.length = length;
-                                cpy.initial_rw_counter = rw_counter;
-                                cpy.bytes = {};
-
-                                // TODO: add read operations on calldata after calldata final design
-                                for( std::size_t i = 0; i < length; i++){
-                                    _rw_operations.push_back(memory_rw_operation(call_id, dest+i, rw_counter++, true, memory_next[dest+i]));
-                                    cpy.bytes.push_back(memory_next[dest+i]); //TODO: change it on calldata
-                                }
-                                _copy_events.push_back(cpy);
-                                memory_size_before = memory_next.size();
-                            } else if(opcode == "CODESIZE") {
-                                // 0x38
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "CODESIZE" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "CODECOPY") {
-                                // 0x39
-                                std::cout << "CODECOPY not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-
-                                // TODO: add length write operations to memory
-                                // Consistency with bytecode table will be checked by bytecode circuit
-                            } else if(opcode == "GASPRICE") {
-                                // 0x3a
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "GASPRICE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "EXTCODESIZE") {
-                                // 0x3b
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "EXTCODESIZE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "EXTCODECOPY") {
-                                // 0x3c
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "EXTCODECOPY not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-
-                                // TODO: add length write operations to memory
-                                // Consistency with bytecode table will be checked by bytecode circuit
-                            } else if(opcode == "RETURNDATASIZE") {
-                                // 0x3d
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "RETURNDATASIZE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "RETURNDATACOPY") {
-                                // 0x3e
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "RETURNDATACOPY not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-
-                                // TODO: add length write operations to memory
-                                // Where will consistency check be done?
-                            } else if(opcode == "EXTCODEHASH") {
-                                // 0x3f
-                                // std::cout << "Test me, please!" << std::endl;
-                                std::cout << "EXTCODEHASH not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "BLOCKHASH") {
-                                // 0x40
-                                std::cout << "BLOCKHASH not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "COINBASE") {
-                                // 0x41
-                                std::cout << "COINBASE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "TIMESTAMP") {
-                                // 0x42
-                                std::cout << "TIMESTAMP not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "NUMBER") {
-                                // 0x43
-                                std::cout << "NUMBER not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "DIFFICULTY") {
-                                // 0x44
-                                std::cout << "DIFFICULTY not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "GASLIMIT") {
-                                // 0x45
-                                std::cout << "GASLIMIT not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "CHAINID") {
-                                // 0x46
-                                std::cout << "CHAINID not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SELFBALANCE") {
-                                // 0x47
-                                std::cout << "SELFBALANCE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "BASEFEE") {
-                                // 0x48
-                                std::cout << "BASEFEE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "BLOBHASH") {
-                                // 0x49
-                                std::cout << "BLOBHASH not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "BLOBBASEFEE") {
-                                // 0x4a
-                                std::cout << "BLOBBASEFEE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "POP") {
-                                // 0x50
-                            } else if(opcode == "MLOAD") {
-                                // 0x51
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, false, stack[stack.size()-1]));
-
-                                zkevm_word_type addr = stack[stack.size() - 1];
-                                BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
-                                // std::cout << "\t\t Address = 0x" << std::hex << addr << std::dec << " memory size " << memory.size() << std::endl;
-                                for( std::size_t i = 0; i < 32; i++){
-                                    _rw_operations.push_back(memory_rw_operation(call_id, addr+i, rw_counter++, false, addr+i < memory.size() ? memory[std::size_t(integral_type(addr+i))]: 0));
-
-                                }
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                                memory_size_before = memory_next.size();
-                            } else if(opcode == "MSTORE") {
-                                // 0x52
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-
-                                zkevm_word_type addr = stack[stack.size() - 1];
-                                BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
-                                // std::cout << "\t\t Address = 0x" << std::hex << addr << std::dec << " memory size " << memory.size() << std::endl;
-                                auto bytes = w_to_8(stack[stack.size() - 2]);
-                                for( std::size_t i = 0; i < 32; i++){
-                                   _rw_operations.push_back(memory_rw_operation(call_id, addr + i, rw_counter++, true, bytes[i]));
-                                }
-                                memory_size_before = memory_next.size();
-                            } else if(opcode == "MSTORE8") {
-                                // 0x53
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-
-                                zkevm_word_type addr = stack[stack.size() - 1];
-                                BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
-                                // std::cout << "\t\t Address = 0x" << std::hex << addr << std::dec << " memory size " << memory.size() << std::endl;
-                                auto bytes = w_to_8(stack[stack.size() - 2]);
-                                _rw_operations.push_back(memory_rw_operation(call_id, addr, rw_counter++, true, bytes[31]));
-                                memory_size_before = memory_next.size();
-                            } else if(opcode == "SLOAD") {
-                                // 0x54
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(storage_rw_operation(
-                                    call_id,
-                                    stack[stack.size()-1], //Storage key
-                                    rw_counter++,
-                                    false,
-                                    storage_next.at(stack[stack.size()-1]),
-                                    storage_next.at(stack[stack.size()-1]) //TODO: Here should be previous value
-                                ));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                                // TODO: here should be previous value
-                                state.storage_slice[stack[stack.size()-1]] = storage_next.at(stack[stack.size()-1]);
-
-                            } else if(opcode == "SSTORE") {
-                                // 0x55
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(storage_rw_operation(
-                                    call_id,
-                                    stack[stack.size()-1],
-                                    rw_counter++,
-                                    true,
-                                    stack[stack.size()-2],
-                                    // TODO: Remove by real initial value
-                                    // Overwise lookup in MPT table won't be correct
-                                    (storage.find(stack[stack.size()-1]) == storage.end())? 0: storage.at(stack[stack.size()-1]))
-                                ); // Second parameter should be transaction_id
-
-                            } else if(opcode == "JUMP") {
-                                // 0x56
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                            } else if(opcode == "JUMPI") {
-                                // 0x57
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-
-                            } else if(opcode == "PC") {
-                                // 0x58
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "MSIZE") {
-                                // 0x58
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "GAS") {
-                                // 0x59
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "JUMPDEST") {
-                                // 0x5a
-                            } else if(opcode == "TLOAD") {
-                                // 0x5b
-                                std::cout << "TLOAD not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, false, stack[stack.size()-1]));
-
-                                // TODO: add trasient storage operations
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-
-                            } else if(opcode == "TSTORE") {
-                                // 0x5c
-                                std::cout << "TSTORE not implemented" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, false, stack[stack.size()-1]));
+                        const boost::property_tree::ptree &ptrace = pt.get_child("result.structLogs");
+                        auto it = ptrace.begin();
+                        process_trace([&ptrace, &it](hardhat_trace_step &step){
+                            if( it == ptrace.end() ) return false;
+                            step = step_from_ptree(it->second);
+                            it++;
+                            return true;
+                        }, call_id, rw_counter);
+                        call_id++;
+                    }
+                    sort_rw_operations(_rw_operations);
+                    _keccaks.finalize();
+                }
 
-                                // TODO: add trasient storage write operations
-                            } else if(opcode == "MCOPY") {
-                                // 0x5d
-                                std::cout << "MCOPY not implemented. Add copy event" << std::endl;
-                                exit(2);
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
+                // debug_traceTransaction outputs are read from the files step by step, without loading them whole
+                zkevm_hardhat_input_generator(
+                    const std::vector<std::vector<std::uint8_t>> bytecodes,
+                    const std::vector<std::string> &trace_paths
+                ){
+                    for( auto &bytecode: bytecodes ){
+                        _keccaks.new_buffer(bytecode);
+                        _bytecodes.new_buffer(bytecode);
+                    }
+                    _bytecodes.finalize();
 
-                                // TODO: add length read operations to memory
-                                // TODO: add length write operations to memory
-                                // Consistensy will be checked by copy circuit
-                            }  else  if(opcode == "PUSH0") {
-                                // 0x5f
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            }  else  if(opcode == "PUSH1") {
-                                // 0x60
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH2") {
-                                // 0x61
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH3") {
-                                // 0x62
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH4") {
-                                // 0x63
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH5") {
-                                // 0x64
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH6") {
-                                // 0x65
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH7") {
-                                // 0x66
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH8") {
-                                // 0x67
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH9") {
-                                // 0x68
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH10") {
-                                // 0x69
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH11") {
-                                // 0x6a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH12") {
-                                // 0x6b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH13") {
-                                // 0x6c
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH14") {
-                                // 0x6d
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH15") {
-                                // 0x6e
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH16") {
-                                // 0x6f
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH17") {
-                                // 0x70
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH18") {
-                                // 0x71
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH19") {
-                                // 0x72
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH20") {
-                                // 0x73
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH21") {
-                                // 0x74
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH22") {
-                                // 0x75
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH23") {
-                                // 0x76
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH24") {
-                                // 0x77
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH25") {
-                                // 0x78
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH26") {
-                                // 0x79
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH27") {
-                                // 0x7a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH28") {
-                                // 0x7b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH29") {
-                                // 0x7c
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH30") {
-                                // 0x7d
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH31") {
-                                // 0x7e
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "PUSH32") {
-                                // 0x7f
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP1") {
-                                // 0x80
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP2") {
-                                // 0x81
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP3") {
-                                // 0x82
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP4") {
-                                // 0x83
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP5") {
-                                // 0x84
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP6") {
-                                // 0x85
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP7") {
-                                // 0x86
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-7, rw_counter++, false, stack[stack.size()-7]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP8") {
-                                // 0x87
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-8, rw_counter++, false, stack[stack.size()-8]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP9") {
-                                // 0x88
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-9, rw_counter++, false, stack[stack.size()-9]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP10") {
-                                // 0x89
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-10, rw_counter++, false, stack[stack.size()-10]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP11") {
-                                // 0x8a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-11, rw_counter++, false, stack[stack.size()-11]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP12") {
-                                // 0x8b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-12, rw_counter++, false, stack[stack.size()-12]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP13") {
-                                // 0x8c
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-13, rw_counter++, false, stack[stack.size()-13]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP14") {
-                                // 0x8d
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-14, rw_counter++, false, stack[stack.size()-14]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP15") {
-                                // 0x8e
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-15, rw_counter++, false, stack[stack.size()-15]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "DUP16") {
-                                // 0x8f
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-16, rw_counter++, false, stack[stack.size()-16]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP1") {
-                                // 0x90
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-2, rw_counter++, true, stack_next[stack_next.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP2") {
-                                // 0x91
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-3, rw_counter++, true, stack_next[stack_next.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP3") {
-                                // 0x92
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-4, rw_counter++, true, stack_next[stack_next.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP4") {
-                                // 0x93
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-5, rw_counter++, true, stack_next[stack_next.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP5") {
-                                // 0x94
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-6, rw_counter++, true, stack_next[stack_next.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP6") {
-                                // 0x95
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-7, rw_counter++, false, stack[stack.size()-7]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-7, rw_counter++, true, stack_next[stack_next.size()-7]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP7") {
-                                // 0x96
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-8, rw_counter++, false, stack[stack.size()-8]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-8, rw_counter++, true, stack_next[stack_next.size()-8]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP8") {
-                                // 0x97
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-9, rw_counter++, false, stack[stack.size()-9]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-9, rw_counter++, true, stack_next[stack_next.size()-9]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP9") {
-                                // 0x98
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-10, rw_counter++, false, stack[stack.size()-10]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-10, rw_counter++, true, stack_next[stack_next.size()-10]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP10") {
-                                // 0x99
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-11, rw_counter++, false, stack[stack.size()-11]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-11, rw_counter++, true, stack_next[stack_next.size()-11]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP11") {
-                                // 0x9a
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-12, rw_counter++, false, stack[stack.size()-12]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-12, rw_counter++, true, stack_next[stack_next.size()-12]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP12") {
-                                // 0x9b
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-13, rw_counter++, false, stack[stack.size()-13]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-13, rw_counter++, true, stack_next[stack_next.size()-13]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP13") {
-                                // 0x9c
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-14, rw_counter++, false, stack[stack.size()-14]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-14, rw_counter++, true, stack_next[stack_next.size()-14]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP14") {
-                                // 0x9d
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-15, rw_counter++, false, stack[stack.size()-15]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-15, rw_counter++, true, stack_next[stack_next.size()-15]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP15") {
-                                // 0x9e
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-16, rw_counter++, false, stack[stack.size()-16]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-16, rw_counter++, true, stack_next[stack_next.size()-16]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "SWAP16") {
-                                // 0x9f
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-17, rw_counter++, false, stack[stack.size()-17]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-17, rw_counter++, true, stack_next[stack_next.size()-17]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "LOG0") {
-                                // 0xa0
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                            } else if(opcode == "LOG1") {
-                                // 0xa1
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                            } else if(opcode == "LOG2") {
-                                // 0xa2
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-                            } else if(opcode == "LOG3") {
-                                // 0xa3
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-5]));
-                            } else if(opcode == "LOG4") {
-                                // 0xa4
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-6]));
-                            } else if(opcode == "CREATE") {
-                                // 0xf0
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "CALL") {
-                                // 0xf1
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-7, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-7]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "CALLCODE") {
-                                // 0xf2
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-7, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-7]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
+                    std::size_t call_id = 0;
+                    std::size_t rw_counter = 0;
+                    for( auto &path: trace_paths){
+                        std::ifstream trace_file(path);
+                        if( !trace_file.is_open() ) throw std::runtime_error("Cannot open hardhat trace " + path);
+                        hardhat_trace_reader reader(trace_file);
+                        process_trace([&reader](hardhat_trace_step &step){ return reader.next(step); }, call_id, rw_counter);
+                        call_id++;
+                    }
+                    sort_rw_operations(_rw_operations);
+                    _keccaks.finalize();
+                }
+            private:
+                static hardhat_trace_step step_from_ptree(const boost::property_tree::ptree &pt){
+                    hardhat_trace_step step;
+                    step.op = pt.get_child("op").data();
+                    step.pc = atoi(pt.get_child("pc").data().c_str());
+                    step.gas = atoi(pt.get_child("gas").data().c_str());
+                    step.stack = zkevm_word_vector_from_ptree(pt.get_child("stack"));
+                    step.memory = byte_vector_from_ptree(pt.get_child("memory"));
+                    step.storage = key_value_storage_from_ptree(pt.get_child("storage"));
+                    return step;
+                }
 
-                            } else if(opcode == "RETURN") {
-                                // 0xf3
-                                std::cout << "\tAdd copy event for RETURN" << std::endl;
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-2]));
-                                std::size_t offset = std::size_t(integral_type(stack[stack.size()-1]));
-                                std::size_t length = std::size_t(integral_type(stack[stack.size()-2]));
+                // next_step(step) fills the next structLogs entry of the transaction, returns false after the last one.
+                // Only the current and the next steps are kept in memory.
+                template<typename StepSource>
+                void process_trace(StepSource next_step, std::size_t call_id, std::size_t &rw_counter){
+                    using integral_type = boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<257>>;
+                    using effect = hardhat_opcode_rw::memory_effect;
+                    const std::array<hardhat_opcode_rw, 256> &opcode_table = hardhat_opcode_rw_table();
+
+                    hardhat_trace_step current;
+                    hardhat_trace_step next;
+                    if( !next_step(current) ) return;
+
+                    std::map<zkevm_word_type, zkevm_word_type> storage = current.storage;
+                    std::map<zkevm_word_type, zkevm_word_type> storage_next;
+                    std::unordered_map<std::string, std::uint16_t> opcode_numbers;
+
+                    std::size_t memory_size_before = 0;
+                    // Consecutive states share unchanged stack and memory pages
+                    zkevm_stack_slice stack_slice;
+                    zkevm_memory_slice memory_slice;
+                    for( bool has_current = true; has_current; ){
+                        bool has_next = next_step(next);
+                        if( has_next ){
+                            storage_next = current.storage;
+                        } else {
+                            next.stack = current.stack;
+                            next.memory = current.memory;
+                        }
+                        const std::vector<zkevm_word_type> &stack = current.stack;
+                        const std::vector<std::uint8_t> &memory = current.memory;
+                        const std::vector<zkevm_word_type> &stack_next = next.stack;
+                        const std::vector<std::uint8_t> &memory_next = next.memory;
+
+                        auto number_it = opcode_numbers.find(current.op);
+                        if( number_it == opcode_numbers.end() )
+                            number_it = opcode_numbers.emplace(current.op, opcode_number_from_str(current.op)).first;
+                        std::uint16_t opcode = number_it->second;
+
+                        zkevm_state state;
+                        state.tx_hash = 0;  // TODO: change it
+                        state.opcode = opcode;
+                        state.call_id = call_id;
+                        state.gas = current.gas;
+                        state.pc = current.pc;
+                        state.rw_counter = rw_counter;
+                        state.bytecode_hash = _bytecodes.get_data()[0].second; // TODO: fix it if possible
+                        state.additional_input = (opcode >= 0x5f && opcode <= 0x7f) ? stack_next[stack_next.size() - 1]: 0;
+                        state.tx_finish = has_next;
+                        state.stack_size = stack.size();
+                        state.memory_size = memory_size_before;
+                        stack_slice.assign(stack);
+                        memory_slice.assign(memory);
+                        state.stack_slice = stack_slice;
+                        state.memory_slice = memory_slice;
+                        // TODO:storage_slice
+                        // Opcode is not presented in RW lookup table. We just take it from json
+                        memory_size_before = memory.size();
+
+                        // Unknown opcodes have empty descriptions, 0xfe is INVALID
+                        const hardhat_opcode_rw &opcode_rw = opcode_table[opcode <= 0xff ? opcode : 0xfe];
+                        if( !opcode_rw.known ){
+                            throw std::runtime_error("Hardhat trace: unknown opcode " + current.op);
+                        }
+                        if( !opcode_rw.implemented ){
+                            throw std::runtime_error("Hardhat trace: opcode " + current.op + " is not implemented");
+                        }
 
-                                copy_event cpy;
-                                cpy.source_id = call_id;
-                                cpy.source_type = copy_operand_type::memory;
-                                cpy.src_address = offset;
-                                cpy.destination_id = call_id;
-                                cpy.destination_type = copy_operand_type::returndata;
-                                cpy.dst_address = 0;
-                                cpy.length = length;
-                                cpy.initial_rw_counter = rw_counter;
-                                cpy.bytes = {};
+                        for( const auto &[address_depth, value_depth]: opcode_rw.stack_reads ){
+                            _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-address_depth, rw_counter++, false, stack[stack.size()-value_depth]));
+                        }
+                        if( opcode_rw.exponentiation ){
+                            _exponentiations.push_back({stack[stack.size() - 1], stack[stack.size() - 2]});
+                        }
 
-                                std::cout << "\tRETURN length = " << length << " memory size = " << memory.size() << " offset = " << offset << std::endl;
-                                std::cout << "\tInitial RW counter = " << std::hex << rw_counter << std::dec << std::endl;
-                                for(std::size_t i = 0; i < length; i++){
-                                    _rw_operations.push_back(memory_rw_operation(call_id, offset+i, rw_counter++, false, offset+i < memory.size() ? memory[offset+i]: 0));
-                                    cpy.bytes.push_back(offset+i < memory.size() ? memory[offset+i]: 0);
-                                }
-                                std::cout << std::endl;
-                                _copy_events.push_back(cpy);
-                            } else if(opcode == "DELEGATECALL") {
-                                // 0xf4
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "CREATE2") {
-                                // 0xf5
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "STATICCALL") {
-                                // 0xfa
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-6, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-5, rw_counter++, false, stack[stack.size()-2]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-4, rw_counter++, false, stack[stack.size()-3]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-3, rw_counter++, false, stack[stack.size()-4]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-5]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-6]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-1, rw_counter++, true, stack_next[stack_next.size()-1]));
-                            } else if(opcode == "REVERT") {
-                                // 0xfd
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-2, rw_counter++, false, stack[stack.size()-1]));
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-2]));
-                            } else if(opcode == "SELFDESTRUCT") {
-                                // 0xff
-                                _rw_operations.push_back(stack_rw_operation(call_id,  stack.size()-1, rw_counter++, false, stack[stack.size()-1]));
-                            } else {
-                                std::cout << "Unknown opcode " << std::hex << opcode << std::dec << std::endl;
-                                BOOST_ASSERT(false);
+                        switch( opcode_rw.effect ){
+                        case effect::none:
+                            break;
+                        case effect::keccak:{
+                            std::size_t length = std::size_t(integral_type(stack[stack.size()-2]));
+                            std::size_t  offset = std::size_t(integral_type(stack[stack.size()-1]));
+                            auto hash_value = stack_next[stack_next.size()-1];
+
+                            copy_event cpy;
+                            cpy.source_id = call_id;
+                            cpy.source_type = copy_operand_type::memory;
+                            cpy.src_address = offset;
+                            cpy.destination_id = hash_value;
+                            cpy.destination_type = copy_operand_type::keccak;
+                            cpy.dst_address = 0;
+                            cpy.length = length;
+                            cpy.initial_rw_counter = rw_counter;
+                            cpy.bytes = {};
+
+                            std::size_t offset_small = w_to_16(offset)[15];
+                            for( std::size_t i = 0; i < length; i++){
+                                _rw_operations.push_back(memory_rw_operation(call_id, offset+i, rw_counter++, false, memory_next[offset_small + i]));
+                                cpy.bytes.push_back(memory_next[offset_small + i]);
                             }
-                            _zkevm_states.push_back(state);
-                            stack = stack_next;
-                            memory = memory_next;
-                            storage = storage_next;
+                            _copy_events.push_back(cpy);
+                            _keccaks.new_buffer(cpy.bytes);
+                            memory_size_before = memory_next.size();
+                            break;
                         }
-                        call_id++;
+                        case effect::calldatacopy:{
+                            std::size_t length = std::size_t(integral_type(stack[stack.size()-3]));
+                            std::size_t src = std::size_t(integral_type(stack[stack.size()-2]));
+                            std::size_t dest = std::size_t(integral_type(stack[stack.size()-1]));
+
+                            copy_event cpy;
+                            cpy.source_id = call_id;
+                            cpy.source_type = copy_operand_type::calldata;
+                            cpy.src_address = src;
+                            cpy.destination_id = call_id;
+                            cpy.destination_type = copy_operand_type::memory;
+                            cpy.dst_address = dest;
+                            cpy.length = length;
+                            cpy.initial_rw_counter = rw_counter;
+                            cpy.bytes = {};
+
+                            // TODO: add read operations on calldata after calldata final design
+                            for( std::size_t i = 0; i < length; i++){
+                                _rw_operations.push_back(memory_rw_operation(call_id, dest+i, rw_counter++, true, memory_next[dest+i]));
+                                cpy.bytes.push_back(memory_next[dest+i]); //TODO: change it on calldata
+                            }
+                            _copy_events.push_back(cpy);
+                            memory_size_before = memory_next.size();
+                            break;
+                        }
+                        case effect::mload:{
+                            zkevm_word_type addr = stack[stack.size() - 1];
+                            BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
+                            for( std::size_t i = 0; i < 32; i++){
+                                _rw_operations.push_back(memory_rw_operation(call_id, addr+i, rw_counter++, false, addr+i < memory.size() ? memory[std::size_t(integral_type(addr+i))]: 0));
+                            }
+                            memory_size_before = memory_next.size();
+                            break;
+                        }
+                        case effect::mstore:{
+                            zkevm_word_type addr = stack[stack.size() - 1];
+                            BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
+                            auto bytes = w_to_8(stack[stack.size() - 2]);
+                            for( std::size_t i = 0; i < 32; i++){
+                                _rw_operations.push_back(memory_rw_operation(call_id, addr + i, rw_counter++, true, bytes[i]));
+                            }
+                            memory_size_before = memory_next.size();
+                            break;
+                        }
+                        case effect::mstore8:{
+                            zkevm_word_type addr = stack[stack.size() - 1];
+                            BOOST_ASSERT_MSG(addr < std::numeric_limits<std::size_t>::max(), "Cannot process so large memory address");
+                            auto bytes = w_to_8(stack[stack.size() - 2]);
+                            _rw_operations.push_back(memory_rw_operation(call_id, addr, rw_counter++, true, bytes[31]));
+                            memory_size_before = memory_next.size();
+                            break;
+                        }
+                        case effect::sload:
+                            _rw_operations.push_back(storage_rw_operation(
+                                call_id,
+                                stack[stack.size()-1], //Storage key
+                                rw_counter++,
+                                false,
+                                storage_next.at(stack[stack.size()-1]),
+                                storage_next.at(stack[stack.size()-1]) //TODO: Here should be previous value
+                            ));
+                            // TODO: here should be previous value
+                            state.storage_slice.set(stack[stack.size()-1], storage_next.at(stack[stack.size()-1]));
+                            break;
+                        case effect::sstore:
+                            _rw_operations.push_back(storage_rw_operation(
+                                call_id,
+                                stack[stack.size()-1],
+                                rw_counter++,
+                                true,
+                                stack[stack.size()-2],
+                                // TODO: Remove by real initial value
+                                // Overwise lookup in MPT table won't be correct
+                                (storage.find(stack[stack.size()-1]) == storage.end())? 0: storage.at(stack[stack.size()-1]))
+                            ); // Second parameter should be transaction_id
+                            break;
+                        case effect::return_data:{
+                            std::size_t offset = std::size_t(integral_type(stack[stack.size()-1]));
+                            std::size_t length = std::size_t(integral_type(stack[stack.size()-2]));
+
+                            copy_event cpy;
+                            cpy.source_id = call_id;
+                            cpy.source_type = copy_operand_type::memory;
+                            cpy.src_address = offset;
+                            cpy.destination_id = call_id;
+                            cpy.destination_type = copy_operand_type::returndata;
+                            cpy.dst_address = 0;
+                            cpy.length = length;
+                            cpy.initial_rw_counter = rw_counter;
+                            cpy.bytes = {};
+
+                            for(std::size_t i = 0; i < length; i++){
+                                _rw_operations.push_back(memory_rw_operation(call_id, offset+i, rw_counter++, false, offset+i < memory.size() ? memory[offset+i]: 0));
+                                cpy.bytes.push_back(offset+i < memory.size() ? memory[offset+i]: 0);
+                            }
+                            _copy_events.push_back(cpy);
+                            break;
+                        }
+                        }
+
+                        for( std::size_t depth: opcode_rw.stack_writes ){
+                            _rw_operations.push_back(stack_rw_operation(call_id,  stack_next.size()-depth, rw_counter++, true, stack_next[stack_next.size()-depth]));
+                        }
+                        _zkevm_states.push_back(state);
+                        storage = storage_next;
+                        std::swap(current, next);
+                        has_current = has_next;
                     }
-                    std::sort(_rw_operations.begin(), _rw_operations.end(), [](rw_operation a, rw_operation b){
-                        return a < b;
-                    });
                 }
             public:
                 virtual zkevm_keccak_buffers keccaks() override {return _keccaks;}
@@ -0,0 +1,281 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Elena Tatuzova   <e.tatuzova@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <istream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nil/blueprint/zkevm/zkevm_word.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace bbf {
+            // One entry of structLogs of debug_traceTransaction output
+            struct hardhat_trace_step{
+                std::string                                 op;
+                std::size_t                                 pc = 0;
+                std::size_t                                 gas = 0;
+                std::vector<zkevm_word_type>                stack;
+                std::vector<std::uint8_t>                   memory;
+                std::map<zkevm_word_type, zkevm_word_type>  storage;
+            };
+
+            // Streaming reader of debug_traceTransaction output. The JSON is never loaded as a whole: steps are parsed
+            // straight from the stream one by one, everything outside of structLogs is skipped.
+            class hardhat_trace_reader{
+            public:
+                hardhat_trace_reader(std::istream &in): _buf(in.rdbuf()), _started(false), _finished(false){}
+
+                // Reads the next structLogs entry, returns false after the last one
+                bool next(hardhat_trace_step &step){
+                    if( _finished ) return false;
+                    if( !_started ){
+                        _started = true;
+                        skip_whitespace();
+                        if( !find_struct_logs() ) error("structLogs not found");
+                    } else {
+                        skip_whitespace();
+                        if( peek() == ',' ) get();
+                    }
+                    skip_whitespace();
+                    if( peek() == ']' ){
+                        get();
+                        _finished = true;
+                        return false;
+                    }
+                    read_step(step);
+                    return true;
+                }
+            private:
+                int peek(){ return _buf->sgetc(); }
+                int get(){ return _buf->sbumpc(); }
+
+                [[noreturn]] void error(const std::string &message){
+                    throw std::runtime_error("Hardhat trace: " + message);
+                }
+
+                void skip_whitespace(){
+                    while( peek() == ' ' || peek() == '\n' || peek() == '\r' || peek() == '\t' ) get();
+                }
+
+                void expect(char c){
+                    skip_whitespace();
+                    if( get() != c ) error(std::string("'") + c + "' expected");
+                }
+
+                // Whether the next value in the current array or object is followed by another one
+                bool next_item(char close){
+                    skip_whitespace();
+                    int c = get();
+                    if( c == ',' ) return true;
+                    if( c == close ) return false;
+                    error(std::string("',' or '") + close + "' expected");
+                }
+
+                void read_string(std::string &result){
+                    expect('"');
+                    result.clear();
+                    while( true ){
+                        int c = get();
+                        if( c == std::char_traits<char>::eof() ) error("unterminated string");
+                        if( c == '"' ) return;
+                        if( c == '\\' ){
+                            c = get();
+                            if( c == 'u' ){
+                                for( std::size_t i = 0; i < 4; i++ ) get();
+                                c = '?';
+                            } else if( c == 'n' ) c = '\n';
+                            else if( c == 't' ) c = '\t';
+                            else if( c == 'r' ) c = '\r';
+                            else if( c == 'b' ) c = '\b';
+                            else if( c == 'f' ) c = '\f';
+                        }
+                        result.push_back(char(c));
+                    }
+                }
+
+                std::size_t read_number(){
+                    skip_whitespace();
+                    if( peek() == '"' ){
+                        read_string(_token);
+                        return std::strtoull(_token.c_str(), nullptr, 0);
+                    }
+                    std::size_t result = 0;
+                    if( peek() == '-' ) error("negative number");
+                    while( peek() >= '0' && peek() <= '9' ) result = result * 10 + (get() - '0');
+                    // Fractions and exponents are not expected in pc and gas, they are dropped
+                    while( peek() == '.' || peek() == 'e' || peek() == 'E' || peek() == '+' || peek() == '-' || (peek() >= '0' && peek() <= '9') ) get();
+                    return result;
+                }
+
+                void skip_value(){
+                    skip_whitespace();
+                    int c = peek();
+                    if( c == '"' ){
+                        read_string(_token);
+                    } else if( c == '{' || c == '[' ){
+                        char close = (c == '{') ? '}' : ']';
+                        get();
+                        skip_whitespace();
+                        if( peek() == close ){
+                            get();
+                            return;
+                        }
+                        do {
+                            if( close == '}' ){
+                                read_string(_token);
+                                expect(':');
+                            }
+                            skip_value();
+                        } while( next_item(close) );
+                    } else {
+                        while( c != ',' && c != '}' && c != ']' && c != std::char_traits<char>::eof() ){
+                            get();
+                            c = peek();
+                        }
+                    }
+                }
+
+                // Goes into result.structLogs (or top-level structLogs), stops after its '['
+                bool find_struct_logs(){
+                    expect('{');
+                    skip_whitespace();
+                    if( peek() == '}' ){
+                        get();
+                        return false;
+                    }
+                    do {
+                        std::string key;
+                        read_string(key);
+                        expect(':');
+                        skip_whitespace();
+                        if( key == "structLogs" && peek() == '[' ){
+                            get();
+                            return true;
+                        }
+                        if( key == "result" && peek() == '{' ){
+                            if( find_struct_logs() ) return true;
+                        } else {
+                            skip_value();
+                        }
+                    } while( next_item('}') );
+                    return false;
+                }
+
+                template<typename Function>
+                void read_array(Function read_item){
+                    expect('[');
+                    skip_whitespace();
+                    if( peek() == ']' ){
+                        get();
+                        return;
+                    }
+                    do { read_item(); } while( next_item(']') );
+                }
+
+                // Hex string, optionally 0x-prefixed, up to 64 digits
+                zkevm_word_type read_word(){
+                    read_string(_token);
+                    std::size_t begin = (_token.size() >= 2 && _token[0] == '0' && (_token[1] == 'x' || _token[1] == 'X')) ? 2 : 0;
+                    if( _token.size() - begin > 64 ) error("word is longer than 256 bits");
+                    zkevm_word_integral_type result = 0;
+                    std::size_t i = begin;
+                    // 64-bit limbs, the first one may be shorter
+                    std::size_t limb_end = begin + (_token.size() - begin) % 16;
+                    if( limb_end == begin ) limb_end += 16;
+                    while( i < _token.size() ){
+                        std::uint64_t limb = 0;
+                        for( ; i < limb_end && i < _token.size(); i++ ) limb = (limb << 4) | char_to_hex(_token[i]);
+                        result = (result << 64) | limb;
+                        limb_end += 16;
+                    }
+                    return zwordc(result);
+                }
+
+                void read_memory_word(std::vector<std::uint8_t> &memory){
+                    read_string(_token);
+                    for( std::size_t i = 0; i + 1 < _token.size(); i += 2 ){
+                        memory.push_back(char_to_hex(_token[i]) * 16 + char_to_hex(_token[i + 1]));
+                    }
+                }
+
+                void read_step(hardhat_trace_step &step){
+                    step.op.clear();
+                    step.pc = 0;
+                    step.gas = 0;
+                    step.stack.clear();
+                    step.memory.clear();
+                    step.storage.clear();
+
+                    expect('{');
+                    skip_whitespace();
+                    if( peek() == '}' ){
+                        get();
+                        return;
+                    }
+                    do {
+                        read_string(_key);
+                        expect(':');
+                        if( _key == "op" ){
+                            read_string(step.op);
+                        } else if( _key == "pc" ){
+                            step.pc = read_number();
+                        } else if( _key == "gas" ){
+                            step.gas = read_number();
+                        } else if( _key == "stack" ){
+                            read_array([this, &step](){ step.stack.push_back(read_word()); });
+                        } else if( _key == "memory" ){
+                            read_array([this, &step](){ read_memory_word(step.memory); });
+                        } else if( _key == "storage" ){
+                            expect('{');
+                            skip_whitespace();
+                            if( peek() == '}' ){
+                                get();
+                                continue;
+                            }
+                            do {
+                                zkevm_word_type key = read_word();
+                                expect(':');
+                                step.storage[key] = read_word();
+                            } while( next_item('}') );
+                        } else {
+                            skip_value();
+                        }
+                    } while( next_item('}') );
+                }
+
+                std::streambuf *_buf;
+                bool            _started;
+                bool            _finished;
+                std::string     _key;
+                std::string     _token;
+            };
+        } // namespace bbf
+    } // namespace blueprint
+} // namespace nil
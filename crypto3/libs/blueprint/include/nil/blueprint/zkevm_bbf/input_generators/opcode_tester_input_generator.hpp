@@ -60,19 +60,22 @@ namespace nil {
                     transactions_amount++;
                     _keccaks.new_buffer(tester.get_bytecode());
                     std::size_t current_buffer_id = _bytecodes.new_buffer(tester.get_bytecode());
+                    _keccaks.finalize();
+                    _bytecodes.finalize();
 
                     std::size_t call_id = transactions_amount - 1;
                     std::size_t pc = 0;
                     std::size_t gas = initial_gas;
                     std::vector<zkevm_word_type> stack;
                     zkevm_word_type bytecode_hash = _bytecodes.get_data()[current_buffer_id].second;
-                    const std::map<std::size_t, std::uint8_t> memory;
-                    const std::map<zkevm_word_type, zkevm_word_type> storage;
+                    zkevm_stack_slice stack_slice;
+                    const zkevm_memory_slice memory;
+                    const zkevm_storage_slice storage;
 
                     while(true){
                         auto [opcode,additional_input] = tester.get_opcode_by_pc(pc);
 
-                        zkevm_state state;              // TODO:optimize
+                        zkevm_state state;
                         state.tx_hash = 0;              // * change it
                         state.opcode = opcode_to_number(opcode);
                         state.call_id = call_id;
@@ -84,7 +87,8 @@ namespace nil {
                         //state.tx_finish = (ind == tester.get_opcodes().size() - 1);
                         state.stack_size = stack.size();
                         state.memory_size = memory.size();
-                        state.stack_slice = stack;
+                        stack_slice.assign(stack);
+                        state.stack_slice = stack_slice;
                         state.memory_slice = memory;
                         state.storage_slice = storage;
                         _zkevm_states.push_back(state);
@@ -698,9 +702,7 @@ namespace nil {
                         }
                     }
 
-                    std::sort(_rw_operations.begin(), _rw_operations.end(), [](rw_operation a, rw_operation b){
-                        return a < b;
-                    });
+                    sort_rw_operations(_rw_operations);
                 }
             public:
                 virtual zkevm_keccak_buffers keccaks() override {return _keccaks;}
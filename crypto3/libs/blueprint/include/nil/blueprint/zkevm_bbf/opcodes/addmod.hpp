@@ -462,7 +462,7 @@ namespace nil {
                             Res1};
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                     }
                 }
             };
@@ -174,7 +174,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tAssignment implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tAssignment implemented";
                     }
                 }
             };
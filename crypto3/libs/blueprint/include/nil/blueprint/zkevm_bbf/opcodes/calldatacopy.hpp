@@ -108,7 +108,7 @@ namespace nil {
                         // };
                         // lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tSTATE transition implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tSTATE transition implemented";
                     }
                 }
             };
@@ -57,7 +57,7 @@ namespace nil {
                         constrain(current_state.memory_size(0) - current_state.memory_size_next());     // memory_size transition
                         constrain(current_state.rw_counter_next() - current_state.rw_counter(0) - 1);   // rw_counter transition
                     } else {
-                        std::cout << "\tSTATE transition implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tSTATE transition implemented";
                     }
                 }
             };
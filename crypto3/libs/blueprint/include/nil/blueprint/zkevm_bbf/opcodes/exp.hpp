@@ -69,11 +69,10 @@ namespace nil {
                         if( integral_type(current_state.stack_top(1)) == 0 ) s = 0;
                         if( integral_type(current_state.stack_top(1)) == 1 ) s = 0;
 
-                        std::cout << "\t"
+                        BOOST_LOG_TRIVIAL(trace) << "\t"
                             << current_state.stack_top() << " ^ "
                             << current_state.stack_top(1) << " = "
-                            << exp_by_squaring(current_state.stack_top(), current_state.stack_top(1))
-                            << std::endl;
+                            << exp_by_squaring(current_state.stack_top(), current_state.stack_top(1));
                         for( std::size_t i = 0; i < 16; i++){
                             A[i] = a[i];
                             D[i] = d[i];
@@ -168,7 +167,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_exp");
                     } else {
-                        std::cout << "\tAssignment implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tAssignment implemented";
                     }
                 }
             };
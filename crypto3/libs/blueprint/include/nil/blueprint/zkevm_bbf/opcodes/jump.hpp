@@ -53,7 +53,7 @@ namespace nil {
                 {
                     TYPE addr;
                     if constexpr( stage == GenerationStage::ASSIGNMENT ){
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                         auto add_chunks = nil::blueprint::w_to_16(current_state.stack_top());
                         addr = add_chunks[15];
                     }
@@ -134,7 +134,7 @@ namespace nil {
                         constrain(current_state.memory_size(0) - current_state.memory_size_next());     // memory_size transition
                         constrain(current_state.rw_counter_next() - current_state.rw_counter(0));   // rw_counter transition
                     } else {
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                     }
                 }
             };
@@ -141,7 +141,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                     }
                 }
             };
@@ -84,19 +84,18 @@ namespace nil {
                         memory_mod31 = 31 - memory_mod;
                         memory_words = current_state.memory_size %32 == 0? current_state.memory_size/32 : current_state.memory_size / 32 + 1;
 
-                        std::cout << "\tMemory words = " << memory_words
+                        BOOST_LOG_TRIVIAL(trace) << "\tMemory words = " << memory_words
                             <<  " memory size = " << current_state.memory_size
                             << " memory mod = " << memory_mod
                             << " address = " << address
                             << " last_address = " << last_address
                             << " addr_mod = " << addr_mod
-                            << " addr_words = " << addr_words
-                            << std::endl;
+                            << " addr_words = " << addr_words;
                         is_memory_size_changed = (addr_words > memory_words);
                         if( is_memory_size_changed != 0 ) {
-                            std::cout << "\tMEMORY SIZE CHANGED "  << addr_words << " > " << memory_words << std::endl;
+                            BOOST_LOG_TRIVIAL(trace) << "\tMEMORY SIZE CHANGED "  << addr_words << " > " << memory_words;
                         } else {
-                            std::cout << "\tMEMORY SIZE NOT CHANGED " << addr_words << " <= " << memory_words << std::endl;
+                            BOOST_LOG_TRIVIAL(trace) << "\tMEMORY SIZE NOT CHANGED " << addr_words << " <= " << memory_words;
                         }
                     }
                     for( std::size_t i = 0; i < 16; i++ ){
@@ -191,7 +190,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                     }
                 }
             };
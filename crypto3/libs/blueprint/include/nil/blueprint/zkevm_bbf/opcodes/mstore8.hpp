@@ -68,7 +68,7 @@ namespace nil {
                     // TYPE memory_quad_r;
                     std::vector<TYPE> value(32);
                     if constexpr( stage == GenerationStage::ASSIGNMENT ){
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                         auto address = w_to_16(current_state.stack_top())[15];
                         addr = address;
                         addr1 = address;
@@ -97,19 +97,18 @@ namespace nil {
                         // memory_quad_r = ((std::size_t(memory_words) * std::size_t(memory_words)) / 512);
                         // memory_quad_mod512 = 512 - memory_quad_mod;
 
-                        std::cout << "\tMemory words = " << memory_words
+                        BOOST_LOG_TRIVIAL(trace) << "\tMemory words = " << memory_words
                             <<  " memory size = " << current_state.memory_size
                             << " memory mod = " << memory_mod
                             << " address = " << address
                             << " last_address = " << last_address
                             << " addr_mod = " << addr_mod
-                            << " addr_words = " << addr_words
-                            << std::endl;
+                            << " addr_words = " << addr_words;
                         is_memory_size_changed = (addr_words > memory_words);
                         if( is_memory_size_changed != 0 ) {
-                            std::cout << "\tMEMORY SIZE CHANGED "  << addr_words << " > " << memory_words << std::endl;
+                            BOOST_LOG_TRIVIAL(trace) << "\tMEMORY SIZE CHANGED "  << addr_words << " > " << memory_words;
                         } else {
-                            std::cout << "\tMEMORY SIZE NOT CHANGED " << addr_words << " <= " << memory_words << std::endl;
+                            BOOST_LOG_TRIVIAL(trace) << "\tMEMORY SIZE NOT CHANGED " << addr_words << " <= " << memory_words;
                         }
                     }
                     for( std::size_t i = 0; i < 16; i++){
@@ -187,7 +186,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tASSIGNMENT implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tASSIGNMENT implemented";
                     }
                 }
             };
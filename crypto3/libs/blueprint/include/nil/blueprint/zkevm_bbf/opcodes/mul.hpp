@@ -104,9 +104,9 @@ namespace nil {
                         auto a = w_to_16(current_state.stack_top());
                         auto b = w_to_16(current_state.stack_top(1));
                         auto r = w_to_16(current_state.stack_top() * current_state.stack_top(1));
-                        std::cout << "\ta = " << std::hex << current_state.stack_top() << std::dec << std::endl;
-                        std::cout << "\tb = " << std::hex << current_state.stack_top(1) << std::dec << std::endl;
-                        std::cout << "\tr = " << std::hex << current_state.stack_top() * current_state.stack_top(1) << std::dec << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\ta = " << std::hex << current_state.stack_top() << std::dec;
+                        BOOST_LOG_TRIVIAL(trace) << "\tb = " << std::hex << current_state.stack_top(1) << std::dec;
+                        BOOST_LOG_TRIVIAL(trace) << "\tr = " << std::hex << current_state.stack_top() * current_state.stack_top(1) << std::dec;
                         for( std::size_t i = 0; i < 16; i++){
                             A[i] = a[i];
                             B[i] = b[i];
@@ -222,7 +222,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "\tAssignment implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tAssignment implemented";
                     }
                 }
             };
@@ -105,7 +105,7 @@ namespace nil {
                         };
                         lookup(tmp, "zkevm_rw");
                     } else {
-                        std::cout << "Assignment implemented" << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "Assignment implemented";
                     }
                 }
             };
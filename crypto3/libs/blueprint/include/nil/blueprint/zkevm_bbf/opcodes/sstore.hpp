@@ -56,7 +56,7 @@ namespace nil {
                     if constexpr( stage == GenerationStage::ASSIGNMENT ){
                         K_hi = w_hi<FieldType>(current_state.stack_top());
                         K_lo = w_lo<FieldType>(current_state.stack_top());
-                        std::cout << "\tKey = " << current_state.stack_top() << "=[" <<K_hi << "," << K_lo << "] value = " << current_state.stack_top(1) << std::endl;
+                        BOOST_LOG_TRIVIAL(trace) << "\tKey = " << current_state.stack_top() << "=[" <<K_hi << "," << K_lo << "] value = " << current_state.stack_top(1);
                         auto v = w_to_16(current_state.stack_top(1));
                         for(std::size_t i = 0; i < 16; i++) V[i] = v[i];
                     }
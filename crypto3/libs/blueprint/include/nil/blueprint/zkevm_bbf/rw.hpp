@@ -135,7 +135,7 @@ namespace nil {
                     std::vector<TYPE> sorted_prev;
 
                     if constexpr (stage == GenerationStage::ASSIGNMENT) {
-                        auto rw_trace = input;
+                        const auto &rw_trace = input;
                         std::cout << "RW trace.size = " << rw_trace.size() << std::endl;
                         for( std::size_t i = 0; i < rw_trace.size(); i++ ){
                             integral_type mask = (1 << op_bits_amount);
@@ -71,19 +71,21 @@ namespace nil {
                     if constexpr (stage == GenerationStage::ASSIGNMENT) {
                         TYPE theta = input.rlc_challenge;
 
+                        const auto &buffers = input.private_input.get_data();
+                        const zkevm_word_type empty_hash = zkevm_keccak_hash({});
                         std::size_t input_idx = 0;
                         std::size_t block_counter = 0;
                         std::vector<std::uint8_t> msg;
                         zkevm_word_type hash;
 
                         while( block_counter < max_blocks ) {
-                            if( input_idx < input.private_input.input.size() ){
-                                msg = std::get<0>(input.private_input.input[input_idx]);
-                                hash = std::get<1>(input.private_input.input[input_idx]);
+                            if( input_idx < buffers.size() ){
+                                msg = std::get<0>(buffers[input_idx]);
+                                hash = std::get<1>(buffers[input_idx]);
                                 input_idx++;
                             } else {
                                 msg = {};
-                                hash = zkevm_keccak_hash(msg);
+                                hash = empty_hash;
                             }
                             TYPE RLC_value = calculateRLC<FieldType>(msg, theta);
                             for( std::size_t block = 0; block < std::ceil(float(msg.size() + 1)/136); block++){
@@ -24,11 +24,18 @@
 //---------------------------------------------------------------------------//
 
 #pragma once
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
 
 #include <nil/blueprint/components/hashes/keccak/util.hpp> //Move needed utils to bbf
 #include <nil/blueprint/bbf/generic.hpp>
+#include <nil/blueprint/utils/parallel_for.hpp>
 
 #include <nil/blueprint/zkevm/zkevm_word.hpp>
 
@@ -47,36 +54,134 @@ namespace nil {
                 return hash_value;
             }
 
+            // Buffers are hashed lazily. Every buffer keeps a sponge which has absorbed all its complete blocks,
+            // so appending a byte costs at most one permutation. finalize computes the hashes of all the buffers
+            // changed since the previous call, in parallel, and must be called before get_data.
             class zkevm_keccak_buffers {
             public:
                 using zkevm_word_type = nil::blueprint::zkevm_word_type;
                 using data_item = std::pair<std::vector<std::uint8_t>, zkevm_word_type>;
                 using data_type = std::vector<data_item>;
 
+                // The hashes are taken as they are.
                 void fill_data(const data_type& _input){
                     input = _input;
+                    sponges.assign(input.size(), sponge_type());
+                    changed.clear();
                 }
 
+                // The hash is taken as it is, until the buffer is appended to.
                 std::size_t new_buffer(const data_item &_pair){
                     input.push_back(_pair);
+                    sponges.emplace_back();
                     return input.size() - 1;
                 }
 
                 std::size_t new_buffer(const std::vector<std::uint8_t>& buffer){
-                    input.push_back({buffer, zkevm_keccak_hash(buffer)});
+                    input.push_back({buffer, zkevm_word_type(0)});
+                    sponges.emplace_back();
+                    absorb_blocks(input.size() - 1);
                     return input.size() - 1;
                 }
 
                 void push_byte(std::size_t code_id, std::uint8_t b){
                     BOOST_ASSERT(code_id < input.size());
                     input[code_id].first.push_back(b);
-                    input[code_id].second = zkevm_keccak_hash(input[code_id].first);
+                    absorb_blocks(code_id);
+                }
+
+                void append(std::size_t code_id, const std::uint8_t *bytes, std::size_t size){
+                    BOOST_ASSERT(code_id < input.size());
+                    input[code_id].first.insert(input[code_id].first.end(), bytes, bytes + size);
+                    absorb_blocks(code_id);
                 }
 
+                template<typename ByteRange>
+                void append(std::size_t code_id, const ByteRange &bytes){
+                    BOOST_ASSERT(code_id < input.size());
+                    input[code_id].first.insert(input[code_id].first.end(), std::begin(bytes), std::end(bytes));
+                    absorb_blocks(code_id);
+                }
+
+                void finalize(){
+                    const std::size_t threads_amount =
+                        std::min(changed.size() / min_buffers_per_thread, hardware_threads_amount());
+                    parallel_for(changed.size(), [this](std::size_t k) { hash_buffer(changed[k]); }, threads_amount);
+                    for( std::size_t code_id : changed ) sponges[code_id].hashed = true;
+                    changed.clear();
+                }
+
+                bool finalized() const{ return changed.empty(); }
+
                 const data_type &get_data() const{
+                    if( !finalized() )
+                        throw std::logic_error("zkevm_keccak_buffers: buffers changed after the last finalize");
                     return input;
                 }
-                data_type input;
+            private:
+                using hash_type = nil::crypto3::hashes::keccak_1600<256>;
+                using policy_type = typename hash_type::policy_type;
+                using state_type = typename policy_type::state_type;
+                using impl_type = nil::crypto3::hashes::detail::keccak_1600_impl<policy_type>;
+
+                static constexpr std::size_t rate_bytes = policy_type::block_bits / 8;
+                static constexpr std::size_t word_bytes = policy_type::word_bits / 8;
+                // A single permutation is cheap, each thread of finalize gets at least this many buffers.
+                static constexpr std::size_t min_buffers_per_thread = 64;
+
+                struct sponge_type{
+                    state_type  state = {};
+                    std::size_t absorbed = 0;   // bytes of the buffer already permuted into the state
+                    bool        hashed = true;  // whether input[i].second is the hash of input[i].first
+                };
+
+                static void absorb(state_type &state, const std::uint8_t *block){
+                    for( std::size_t i = 0; i < policy_type::block_words; i++ ){
+                        typename policy_type::word_type word = 0;
+                        for( std::size_t j = 0; j < word_bytes; j++ )
+                            word |= typename policy_type::word_type(block[i * word_bytes + j]) << (8 * j);
+                        state[i] ^= word;
+                    }
+                    impl_type::permute(state);
+                }
+
+                // Absorbs complete blocks only, the hash is left for finalize.
+                void absorb_blocks(std::size_t code_id){
+                    sponge_type &sponge = sponges[code_id];
+                    const std::vector<std::uint8_t> &buffer = input[code_id].first;
+                    for( ; sponge.absorbed + rate_bytes <= buffer.size(); sponge.absorbed += rate_bytes )
+                        absorb(sponge.state, buffer.data() + sponge.absorbed);
+                    if( sponge.hashed ){
+                        sponge.hashed = false;
+                        changed.push_back(code_id);
+                    }
+                }
+
+                // The sponge itself is kept unpadded, so the buffer may be appended to later.
+                void hash_buffer(std::size_t code_id){
+                    const sponge_type &sponge = sponges[code_id];
+                    const std::vector<std::uint8_t> &buffer = input[code_id].first;
+                    BOOST_ASSERT(buffer.size() - sponge.absorbed < rate_bytes);
+
+                    std::array<std::uint8_t, rate_bytes> block = {};
+                    std::copy(buffer.begin() + sponge.absorbed, buffer.end(), block.begin());
+                    block[buffer.size() - sponge.absorbed] ^= 0x01;
+                    block[rate_bytes - 1] ^= 0x80;
+                    state_type state = sponge.state;
+                    absorb(state, block.data());
+
+                    typename hash_type::digest_type d;
+                    for( std::size_t j = 0; j < d.size(); j++ )
+                        d[j] = std::uint8_t(state[j / word_bytes] >> (8 * (j % word_bytes)));
+                    nil::crypto3::algebra::fields::field<256>::integral_type n(d);
+                    input[code_id].second = zkevm_word_type(n);
+                }
+
+                data_type                input;
+                // sponges[i] belongs to input[i]
+                std::vector<sponge_type> sponges;
+                // Buffers which are not hashed yet, each of them once
+                std::vector<std::size_t> changed;
             };
 
         } // namespace bbf
@@ -31,6 +31,7 @@
 
 #include <nil/blueprint/zkevm/zkevm_word.hpp>
 #include <nil/blueprint/zkevm/util/ptree.hpp>
+#include <nil/blueprint/utils/radix_sort.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -118,6 +119,31 @@ namespace nil {
                 return rw_operation({rw_operation_type::padding, 0, 0, 0, 0, 0, 0, 0});
             }
 
+            // Bytes of op, call_id, address, field, storage_key and rw_counter, in the order operator< compares them
+            static constexpr std::size_t rw_operation_sort_key_size = 1 + 8 + 32 + 1 + 32 + 8;
+
+            void pack_rw_operation_word(const zkevm_word_type &word, std::uint8_t *out){
+                zkevm_word_integral_type tmp(word);
+                for(std::size_t i = 0; i < 4; i++){
+                    pack_big_endian(std::uint64_t(tmp & 0xFFFFFFFFFFFFFFFF), 8, out + 24 - 8 * i); tmp >>= 64;
+                }
+            }
+
+            // Bytewise order of the keys is the order of rw_operation::operator<
+            void pack_rw_operation_sort_key(const rw_operation &rw_op, std::uint8_t *key){
+                key[0] = std::uint8_t(rw_op.op);
+                pack_big_endian(rw_op.call_id, 8, key + 1);
+                pack_rw_operation_word(rw_op.address, key + 9);
+                key[41] = rw_op.field;
+                pack_rw_operation_word(rw_op.storage_key, key + 42);
+                pack_big_endian(rw_op.rw_counter, 8, key + 74);
+            }
+
+            // Same result as std::stable_sort, but the operations are sorted by packed keys with the radix sort
+            void sort_rw_operations(std::vector<rw_operation> &rw_ops){
+                sort_by_packed_key<rw_operation_sort_key_size>(rw_ops, pack_rw_operation_sort_key);
+            }
+
             class rw_operations_vector: public std::vector<rw_operation>{
             public:
                 rw_operations_vector(){
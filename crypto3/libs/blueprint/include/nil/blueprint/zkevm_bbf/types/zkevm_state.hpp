@@ -30,6 +30,7 @@
 #include <nil/blueprint/bbf/generic.hpp>
 
 #include <nil/blueprint/zkevm/zkevm_word.hpp>
+#include <nil/blueprint/zkevm_bbf/types/zkevm_state_slices.hpp>
 
 namespace nil {
     namespace blueprint {
@@ -55,29 +56,36 @@ namespace nil {
                 }
 
                 zkevm_word_type memory(std::size_t addr) const{
-                    if( memory_slice.find(addr) == memory_slice.end() )
-                        return 0;
-                    else
-                        return memory_slice.at(addr);
+                    return memory_slice[addr];
                 }
 
                 zkevm_word_type storage(zkevm_word_type key) const{
-                    if( storage_slice.find(key) == storage_slice.end() )
-                        return 0;
-                    else
-                        return storage_slice.at(key);
+                    return storage_slice[key];
                 }
+
+                // Slices are shared with the states they were copied from, so consecutive states cost only the
+                // pages they change.
+                zkevm_state(
+                    const zkevm_stack_slice   &stack,
+                    const zkevm_memory_slice  &memory,
+                    const zkevm_storage_slice &storage
+                ): stack_slice(stack), memory_slice(memory), storage_slice(storage){}
+
                 zkevm_state(
                     const std::vector<zkevm_word_type>        &stack,
                     const std::map<std::size_t, std::uint8_t> &memory,
                     const std::map<zkevm_word_type, zkevm_word_type> &storage
-                ): stack_slice(stack), memory_slice(memory), storage_slice(storage){}
+                ){
+                    stack_slice.assign(stack);
+                    for( const auto &[addr, value] : memory ) memory_slice.set(addr, value);
+                    storage_slice.assign(storage);
+                }
 
                 zkevm_state(){}
             public:
-                std::vector<zkevm_word_type>                stack_slice; // BEFORE opcode
-                std::map<std::size_t, std::uint8_t>         memory_slice; // BEFORE opcode
-                std::map<zkevm_word_type, zkevm_word_type>  storage_slice; // BEFORE opcode
+                zkevm_stack_slice    stack_slice; // BEFORE opcode
+                zkevm_memory_slice   memory_slice; // BEFORE opcode
+                zkevm_storage_slice  storage_slice; // BEFORE opcode
             };
 
             template <typename FieldType, GenerationStage stage>
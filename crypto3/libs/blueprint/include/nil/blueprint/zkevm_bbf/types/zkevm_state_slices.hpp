@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Elena Tatuzova   <e.tatuzova@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/blueprint/zkevm/zkevm_word.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace bbf {
+            // Array split into fixed size pages. Copies share the pages, a page is copied only when one of the copies
+            // changes it. Values past the end and values in pages that were never written are zero.
+            template<typename T, std::size_t PageSize>
+            class paged_slice{
+            public:
+                using value_type = T;
+
+                paged_slice(): _size(0){}
+
+                std::size_t size() const{ return _size; }
+                bool empty() const{ return _size == 0; }
+
+                T operator[](std::size_t i) const{
+                    if( i >= _size ) return T();
+                    const auto &page = (*_pages)[i / PageSize];
+                    return page ? (*page)[i % PageSize] : T();
+                }
+
+                T back() const{
+                    BOOST_ASSERT(_size > 0);
+                    return (*this)[_size - 1];
+                }
+
+                void set(std::size_t i, const T &value){
+                    if( i >= _size ) resize(i + 1);
+                    if( (*this)[i] == value ) return;
+                    writable_page(i / PageSize)[i % PageSize] = value;
+                }
+
+                void push_back(const T &value){ set(_size, value); }
+
+                void pop_back(){
+                    BOOST_ASSERT(_size > 0);
+                    resize(_size - 1);
+                }
+
+                void resize(std::size_t size){
+                    if( size == _size ) return;
+                    // Cut values in the last kept page, they should read as zero if the slice grows back.
+                    std::size_t kept_end = std::min(_size, pages_amount(size) * PageSize);
+                    for( std::size_t i = size; i < kept_end; i++ ) set(i, T());
+                    if( !_pages || pages_amount(size) != _pages->size() ) writable_table().resize(pages_amount(size));
+                    _size = size;
+                }
+
+                // Only pages with changed values are copied, the rest stay shared with the other copies.
+                template<typename Container>
+                void assign(const Container &values){
+                    resize(values.size());
+                    std::size_t i = 0;
+                    for( const auto &value : values ) set(i++, value);
+                }
+
+                std::vector<T> to_vector() const{
+                    std::vector<T> result(_size);
+                    for( std::size_t i = 0; i < _size; i++ ) result[i] = (*this)[i];
+                    return result;
+                }
+
+                // True if value i of both slices lives in the same page, i.e. neither copy has changed that page.
+                bool shares_page(const paged_slice &other, std::size_t i) const{
+                    if( !_pages || !other._pages ) return false;
+                    if( i / PageSize >= _pages->size() || i / PageSize >= other._pages->size() ) return false;
+                    const auto &page = (*_pages)[i / PageSize];
+                    return page && page == (*other._pages)[i / PageSize];
+                }
+            private:
+                using page_type = std::array<T, PageSize>;
+                using table_type = std::vector<std::shared_ptr<page_type>>;
+
+                static std::size_t pages_amount(std::size_t size){ return (size + PageSize - 1) / PageSize; }
+
+                table_type &writable_table(){
+                    if( !_pages )
+                        _pages = std::make_shared<table_type>();
+                    else if( _pages.use_count() > 1 )
+                        _pages = std::make_shared<table_type>(*_pages);
+                    return *_pages;
+                }
+
+                page_type &writable_page(std::size_t index){
+                    auto &page = writable_table()[index];
+                    if( !page ){
+                        page = std::make_shared<page_type>();
+                        page->fill(T());
+                    } else if( page.use_count() > 1 ){
+                        page = std::make_shared<page_type>(*page);
+                    }
+                    return *page;
+                }
+
+                std::shared_ptr<table_type> _pages;
+                std::size_t                 _size;
+            };
+
+            // Map shared between copies until one of them changes it. Missing keys are zero.
+            template<typename Key, typename Value>
+            class shared_map_slice{
+            public:
+                using map_type = std::map<Key, Value>;
+
+                std::size_t size() const{ return _map ? _map->size() : 0; }
+
+                Value operator[](const Key &key) const{
+                    if( !_map ) return Value();
+                    auto it = _map->find(key);
+                    return it == _map->end() ? Value() : it->second;
+                }
+
+                void set(const Key &key, const Value &value){
+                    if( _map && _map->count(key) && _map->at(key) == value ) return;
+                    if( !_map )
+                        _map = std::make_shared<map_type>();
+                    else if( _map.use_count() > 1 )
+                        _map = std::make_shared<map_type>(*_map);
+                    (*_map)[key] = value;
+                }
+
+                void assign(const map_type &values){
+                    if( values.empty() )
+                        _map.reset();
+                    else if( !_map || *_map != values )
+                        _map = std::make_shared<map_type>(values);
+                }
+
+                map_type to_map() const{ return _map ? *_map : map_type(); }
+
+                bool shares_map(const shared_map_slice &other) const{ return _map && _map == other._map; }
+            private:
+                std::shared_ptr<map_type> _map;
+            };
+
+            using zkevm_stack_slice = paged_slice<zkevm_word_type, 32>;
+            using zkevm_memory_slice = paged_slice<std::uint8_t, 4096>;
+            using zkevm_storage_slice = shared_map_slice<zkevm_word_type, zkevm_word_type>;
+        } // namespace bbf
+    } // namespace blueprint
+} // namespace nil
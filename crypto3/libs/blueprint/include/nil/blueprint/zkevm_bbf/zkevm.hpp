@@ -27,12 +27,15 @@
 
 #include <functional>
 
+#include <boost/log/trivial.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
 
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 #include <nil/blueprint/component.hpp>
+#include <nil/blueprint/utils/parallel_for.hpp>
 
 #include <nil/blueprint/bbf/generic.hpp>
 #include <nil/blueprint/zkevm_bbf/subcomponents/keccak_table.hpp>
@@ -167,68 +170,86 @@ namespace nil {
 
                     if constexpr (stage == GenerationStage::ASSIGNMENT) {
                         std::cout << "ZKEVM assign size=" << input.zkevm_states.size() << std::endl;
+                        // Rows of every step are fully determined by the rows amounts of the previous ones,
+                        // so we lay out all the steps first and then assign them concurrently.
+                        std::vector<opcode_step> steps;
+                        steps.reserve(input.zkevm_states.size());
                         std::size_t current_row = 0;
                         for( std::size_t i = 0; i <input.zkevm_states.size(); i++ ){
-                            const auto &current_state = input.zkevm_states[i];
-                            zkevm_opcode current_opcode = opcode_from_number(current_state.opcode);
+                            zkevm_opcode current_opcode = opcode_from_number(input.zkevm_states[i].opcode);
 
-                            if( opcode_impls.find(current_opcode) == opcode_impls.end() ){
-                                std::cout << "Opcode not found " << current_opcode << " skip it" << std::endl;
+                            auto impl_it = opcode_impls.find(current_opcode);
+                            if( impl_it == opcode_impls.end() ){
+                                BOOST_LOG_TRIVIAL(warning) << "Opcode not found " << current_opcode << " skip it";
                                 continue;
                             }
-                            std::size_t current_opcode_bare_rows_amount = opcode_impls[current_opcode]->rows_amount();
-                            std::size_t current_opcode_rows_amount = std::ceil(float(current_opcode_bare_rows_amount)/2) * 2;
+                            opcode_step step;
+                            step.state_index = i;
+                            step.opcode = current_opcode;
+                            step.impl = impl_it->second;
+                            step.opcode_id = (std::find(implemented_opcodes.begin(), implemented_opcodes.end(), current_opcode) - implemented_opcodes.begin());
+                            step.row = current_row;
+                            step.bare_rows_amount = step.impl->rows_amount();
+                            step.rows_amount = std::ceil(float(step.bare_rows_amount)/2) * 2;
+                            BOOST_ASSERT(current_row + step.rows_amount <= max_zkevm_rows);
+                            current_row += step.rows_amount;
+                            steps.push_back(step);
+                        }
+
+                        // Witness columns grow on the first write to a row, which must not happen concurrently.
+                        context_object.subcontext(opcode_area, 0, max_zkevm_rows).reserve_rows(current_row);
+
+                        auto assign_step = [&](const opcode_step &step) {
+                            const auto &current_state = input.zkevm_states[step.state_index];
                             // std::cout << "Fresh subcontext:"
-                            //     << current_row + current_opcode_bare_rows_amount%2 << "..."
-                            //     << current_row + current_opcode_bare_rows_amount%2 + current_opcode_bare_rows_amount - 1
+                            //     << step.row + step.bare_rows_amount%2 << "..."
+                            //     << step.row + step.bare_rows_amount%2 + step.bare_rows_amount - 1
                             //     << std::endl;
                             context_type op_ct = context_object.fresh_subcontext(
                                 opcode_area,
-                                current_row + current_opcode_bare_rows_amount%2,
-                                current_row + current_opcode_bare_rows_amount
+                                step.row + step.bare_rows_amount%2,
+                                step.row + step.bare_rows_amount
                             );
-                            std::size_t opcode_id = (std::find(implemented_opcodes.begin(), implemented_opcodes.end(), current_opcode) - implemented_opcodes.begin());
-                            std::cout << current_opcode
-                                << " with id = " << opcode_id
+                            BOOST_LOG_TRIVIAL(trace) << step.opcode
+                                << " with id = " << step.opcode_id
                                 << " will be assigned as " << std::hex << current_state.opcode << std::dec
-                                << " on row " << current_row
-                                << " rows_amount = " << current_opcode_rows_amount
+                                << " on row " << step.row
+                                << " rows_amount = " << step.rows_amount
                                 << " stack_size = " << current_state.stack_size
                                 << " memory_size = " << current_state.memory_size
                                 << " rw_counter = 0x" << std::hex<< current_state.rw_counter << std::dec
-                                << " gas = " << current_state.gas
+                                << " gas = " << current_state.gas;
                                 // << " bytecode_hash = " << current_state.bytecode_hash
-                                << std::endl;
-
-                            for( std::size_t j = 0; j < current_opcode_rows_amount; j++ ){
-                                BOOST_ASSERT(current_row < max_zkevm_rows);
-                                std::size_t row_counter = current_opcode_rows_amount - j - 1;
-                                all_states[current_row]= {};
-                                all_states[current_row].call_id = current_state.call_id;
-                                all_states[current_row].bytecode_hash_hi = w_hi<FieldType>(current_state.bytecode_hash);
-                                all_states[current_row].bytecode_hash_lo = w_lo<FieldType>(current_state.bytecode_hash);
-                                all_states[current_row].pc = current_state.pc;
-                                all_states[current_row].opcode = opcode_to_number(current_opcode);
-                                all_states[current_row].gas_hi = (current_state.gas & 0xFFFF0000) >> 16;
-                                all_states[current_row].gas_lo = current_state.gas & 0xFFFF;
-                                all_states[current_row].stack_size = current_state.stack_size;
-                                all_states[current_row].memory_size = current_state.memory_size;
-                                all_states[current_row].rw_counter = current_state.rw_counter;
-                                all_states[current_row].row_counter = row_counter;
-                                all_states[current_row].step_start = (j == 0);
-                                all_states[current_row].row_counter_inv = row_counter == 0? 0: val(row_counter).inversed(); //row_counter_inv
-                                all_states[current_row].opcode_parity = opcode_id % 2; // opcode_parity
-                                all_states[current_row].is_even = 1 - current_row % 2; // is_even
-
-                                opcode_selectors[current_row].resize(opcode_selectors_amount);
-                                if( current_row % 2 ==  (opcode_id % 4 ) / 2) opcode_selectors[current_row][opcode_id/4] = 1;
-                                opcode_row_selectors[current_row].resize(opcode_row_selectors_amount);
-                                opcode_row_selectors[current_row][row_counter/2] = 1;
-                                current_row++;
+
+                            for( std::size_t j = 0; j < step.rows_amount; j++ ){
+                                std::size_t row = step.row + j;
+                                std::size_t row_counter = step.rows_amount - j - 1;
+                                all_states[row]= {};
+                                all_states[row].call_id = current_state.call_id;
+                                all_states[row].bytecode_hash_hi = w_hi<FieldType>(current_state.bytecode_hash);
+                                all_states[row].bytecode_hash_lo = w_lo<FieldType>(current_state.bytecode_hash);
+                                all_states[row].pc = current_state.pc;
+                                all_states[row].opcode = opcode_to_number(step.opcode);
+                                all_states[row].gas_hi = (current_state.gas & 0xFFFF0000) >> 16;
+                                all_states[row].gas_lo = current_state.gas & 0xFFFF;
+                                all_states[row].stack_size = current_state.stack_size;
+                                all_states[row].memory_size = current_state.memory_size;
+                                all_states[row].rw_counter = current_state.rw_counter;
+                                all_states[row].row_counter = row_counter;
+                                all_states[row].step_start = (j == 0);
+                                all_states[row].row_counter_inv = row_counter == 0? 0: val(row_counter).inversed(); //row_counter_inv
+                                all_states[row].opcode_parity = step.opcode_id % 2; // opcode_parity
+                                all_states[row].is_even = 1 - row % 2; // is_even
+
+                                opcode_selectors[row].resize(opcode_selectors_amount);
+                                if( row % 2 ==  (step.opcode_id % 4 ) / 2) opcode_selectors[row][step.opcode_id/4] = 1;
+                                opcode_row_selectors[row].resize(opcode_row_selectors_amount);
+                                opcode_row_selectors[row][row_counter/2] = 1;
                             }
 
-                            opcode_impls[current_opcode]->fill_context(op_ct, current_state);
-                        }
+                            step.impl->fill_context(op_ct, current_state);
+                        };
+                        assign_steps_in_parallel(steps, current_row, assign_step);
 
                         while(current_row < max_zkevm_rows ){
                             std::size_t opcode_id = std::find(implemented_opcodes.begin(), implemented_opcodes.end(), zkevm_opcode::padding) - implemented_opcodes.begin();
@@ -531,6 +552,59 @@ namespace nil {
                    }
                 }
             protected:
+                struct opcode_step {
+                    std::size_t state_index;
+                    zkevm_opcode opcode;
+                    std::shared_ptr<opcode_abstract<FieldType>> impl;
+                    std::size_t opcode_id;
+                    std::size_t row;                // first row of the step
+                    std::size_t bare_rows_amount;
+                    std::size_t rows_amount;        // bare_rows_amount rounded up to even
+                };
+
+                // Steps are assigned in batches of consecutive steps covering at least this many rows.
+                // The allocation log keeps 64 rows of a column in one word of a std::vector<bool>, so
+                // only the neighbouring batches may touch the same word.
+                static constexpr std::size_t min_assignment_batch_rows = 256;
+
+                // Calls assign_step for every step. Batches with even and odd numbers run in two separate
+                // waves, so the batches running at the same time are never neighbours.
+                template<typename AssignStep>
+                static void assign_steps_in_parallel(
+                    const std::vector<opcode_step> &steps,
+                    std::size_t rows_amount,
+                    const AssignStep &assign_step
+                ) {
+                    const std::size_t threads_amount = hardware_threads_amount();
+                    const std::size_t batch_rows = std::max(min_assignment_batch_rows, rows_amount / (8 * threads_amount));
+
+                    std::vector<std::size_t> batch_starts = {0};
+                    std::size_t batch_rows_amount = 0;
+                    for( std::size_t i = 0; i < steps.size(); i++ ){
+                        batch_rows_amount += steps[i].rows_amount;
+                        if( batch_rows_amount >= batch_rows && i + 1 < steps.size() ){
+                            batch_starts.push_back(i + 1);
+                            batch_rows_amount = 0;
+                        }
+                    }
+                    batch_starts.push_back(steps.size());
+                    const std::size_t batches_amount = batch_starts.size() - 1;
+
+                    if( threads_amount == 1 || batches_amount < 2 ){
+                        for( const auto &step: steps ) assign_step(step);
+                        return;
+                    }
+
+                    for( std::size_t parity = 0; parity < 2; parity++ ){
+                        parallel_for((batches_amount + 1 - parity) / 2, [&](std::size_t k) {
+                            const std::size_t batch = 2 * k + parity;
+                            for( std::size_t i = batch_starts[batch]; i < batch_starts[batch + 1]; i++ ){
+                                assign_step(steps[i]);
+                            }
+                        }, threads_amount);
+                    }
+                }
+
                 static constexpr std::size_t max_opcode_height = 8;
                 static constexpr std::size_t opcode_columns_amount = 48;
                 static constexpr std::size_t range_checked_opcode_columns_amount = 32;
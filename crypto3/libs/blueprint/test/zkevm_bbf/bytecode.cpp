@@ -96,6 +96,8 @@ BOOST_AUTO_TEST_CASE(one_contract){
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa"));
     keccak_input.new_buffer(hex_string_to_bytes("0x00ed"));
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa12312384710283470321894798234702918470189347"));
+    input.finalize();
+    keccak_input.finalize();
     test_zkevm_bytecode<field_type>(input, keccak_input, 1000, 30);
 }
 
@@ -107,6 +109,8 @@ BOOST_AUTO_TEST_CASE(two_contracts){
     nil::blueprint::bbf::zkevm_keccak_buffers keccak_input;
     keccak_input.new_buffer(hex_string_to_bytes(bytecode_for));
     keccak_input.new_buffer(hex_string_to_bytes(bytecode_addition));
+    input.finalize();
+    keccak_input.finalize();
 
     test_zkevm_bytecode<field_type>(input, keccak_input, 5000, 30);
 }
@@ -120,6 +124,8 @@ BOOST_AUTO_TEST_CASE(mstore8){
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa"));
     keccak_input.new_buffer(hex_string_to_bytes("0x00ed"));
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa12312384710283470321894798234702918470189347"));
+    input.finalize();
+    keccak_input.finalize();
     test_zkevm_bytecode<field_type>(input, keccak_input, 10000, 50);
 }
 
@@ -134,7 +140,35 @@ BOOST_AUTO_TEST_CASE(not_hashed){
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa"));
     keccak_input.new_buffer(hex_string_to_bytes("0x00ed"));
     keccak_input.new_buffer(hex_string_to_bytes("0xffaa12312384710283470321894798234702918470189347"));
+    input.finalize();
+    keccak_input.finalize();
 
     test_zkevm_bytecode<field_type>(input, keccak_input, 5000, 50, false);
 }
+BOOST_AUTO_TEST_CASE(appended_buffers){
+    std::vector<std::uint8_t> bytecode = hex_string_to_bytes(bytecode_for);
+    nil::blueprint::bbf::zkevm_keccak_buffers input;
+    input.new_buffer(bytecode);
+
+    nil::blueprint::bbf::zkevm_keccak_buffers keccak_input;
+    std::size_t byte_by_byte = keccak_input.new_buffer(std::vector<std::uint8_t>());
+    for( std::uint8_t b : bytecode ) keccak_input.push_byte(byte_by_byte, b);
+    std::size_t in_parts = keccak_input.new_buffer(std::vector<std::uint8_t>(bytecode.begin(), bytecode.begin() + 200));
+    keccak_input.append(in_parts, std::vector<std::uint8_t>(bytecode.begin() + 200, bytecode.end()));
+    BOOST_CHECK(!keccak_input.finalized());
+    BOOST_CHECK_THROW(keccak_input.get_data(), std::logic_error);
+    input.finalize();
+    keccak_input.finalize();
+
+    BOOST_CHECK(keccak_input.get_data()[byte_by_byte].second == nil::blueprint::bbf::zkevm_keccak_hash(bytecode));
+    BOOST_CHECK(keccak_input.get_data()[in_parts].second == nil::blueprint::bbf::zkevm_keccak_hash(bytecode));
+
+    // Buffers stay appendable after their hash is read
+    keccak_input.push_byte(in_parts, 0xff);
+    bytecode.push_back(0xff);
+    keccak_input.finalize();
+    BOOST_CHECK(keccak_input.get_data()[in_parts].second == nil::blueprint::bbf::zkevm_keccak_hash(bytecode));
+
+    test_zkevm_bytecode<field_type>(input, keccak_input, 1000, 30);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,10 @@
 
 #define BOOST_TEST_MODULE blueprint_plonk_l1_wrapper_test
 
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
 #include <boost/assert.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -44,6 +48,7 @@
 #include <nil/blueprint/zkevm_bbf/types/copy_event.hpp>
 #include <nil/blueprint/zkevm_bbf/types/zkevm_state.hpp>
 #include <nil/blueprint/zkevm_bbf/input_generators/hardhat_input_generator.hpp>
+#include <nil/blueprint/zkevm_bbf/input_generators/hardhat_trace_reader.hpp>
 
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
@@ -63,6 +68,59 @@ class zkEVMHardhatTestFixture: public BBFTestFixture {
 public:
     zkEVMHardhatTestFixture():BBFTestFixture(){}
 
+    // Checks that the input generator gives the same result on the trace read step by step from the file as on
+    // the trace loaded whole. Returns the rw operations and the copy events for the fixture specific checks.
+    std::pair<nil::blueprint::bbf::rw_operations_vector, std::vector<nil::blueprint::bbf::copy_event>> check_streamed_trace(const std::string &path){
+        auto [bytecodes, pts] = load_hardhat_input(path);
+        std::vector<std::string> trace_paths = {std::string(TEST_DATA_DIR) + path + "trace0.json"};
+
+        nil::blueprint::bbf::zkevm_hardhat_input_generator loaded(bytecodes, pts);
+        nil::blueprint::bbf::zkevm_hardhat_input_generator streamed(bytecodes, trace_paths);
+
+        auto loaded_rw = loaded.rw_operations();
+        auto streamed_rw = streamed.rw_operations();
+        BOOST_CHECK_EQUAL(loaded_rw.size(), streamed_rw.size());
+        for( std::size_t i = 0; i < std::min(loaded_rw.size(), streamed_rw.size()); i++ ){
+            BOOST_CHECK(loaded_rw[i].op == streamed_rw[i].op);
+            BOOST_CHECK_EQUAL(loaded_rw[i].call_id, streamed_rw[i].call_id);
+            BOOST_CHECK(loaded_rw[i].address == streamed_rw[i].address);
+            BOOST_CHECK(loaded_rw[i].storage_key == streamed_rw[i].storage_key);
+            BOOST_CHECK_EQUAL(loaded_rw[i].rw_counter, streamed_rw[i].rw_counter);
+            BOOST_CHECK_EQUAL(loaded_rw[i].is_write, streamed_rw[i].is_write);
+            BOOST_CHECK(loaded_rw[i].value == streamed_rw[i].value);
+            BOOST_CHECK(loaded_rw[i].initial_value == streamed_rw[i].initial_value);
+        }
+
+        auto loaded_states = loaded.zkevm_states();
+        auto streamed_states = streamed.zkevm_states();
+        BOOST_CHECK_EQUAL(loaded_states.size(), streamed_states.size());
+        for( std::size_t i = 0; i < std::min(loaded_states.size(), streamed_states.size()); i++ ){
+            BOOST_CHECK_EQUAL(loaded_states[i].pc, streamed_states[i].pc);
+            BOOST_CHECK_EQUAL(loaded_states[i].opcode, streamed_states[i].opcode);
+            BOOST_CHECK_EQUAL(loaded_states[i].rw_counter, streamed_states[i].rw_counter);
+            BOOST_CHECK_EQUAL(loaded_states[i].stack_size, streamed_states[i].stack_size);
+            BOOST_CHECK_EQUAL(loaded_states[i].memory_size, streamed_states[i].memory_size);
+        }
+
+        auto loaded_copy = loaded.copy_events();
+        auto streamed_copy = streamed.copy_events();
+        BOOST_CHECK_EQUAL(loaded_copy.size(), streamed_copy.size());
+        for( std::size_t i = 0; i < std::min(loaded_copy.size(), streamed_copy.size()); i++ ){
+            BOOST_CHECK(loaded_copy[i].source_id == streamed_copy[i].source_id);
+            BOOST_CHECK(loaded_copy[i].source_type == streamed_copy[i].source_type);
+            BOOST_CHECK_EQUAL(loaded_copy[i].src_address, streamed_copy[i].src_address);
+            BOOST_CHECK(loaded_copy[i].destination_id == streamed_copy[i].destination_id);
+            BOOST_CHECK(loaded_copy[i].destination_type == streamed_copy[i].destination_type);
+            BOOST_CHECK_EQUAL(loaded_copy[i].dst_address, streamed_copy[i].dst_address);
+            BOOST_CHECK_EQUAL(loaded_copy[i].length, streamed_copy[i].length);
+            BOOST_CHECK_EQUAL(loaded_copy[i].initial_rw_counter, streamed_copy[i].initial_rw_counter);
+            BOOST_CHECK(loaded_copy[i].bytes == streamed_copy[i].bytes);
+        }
+
+        BOOST_CHECK(loaded.keccaks().get_data() == streamed.keccaks().get_data());
+        return {streamed_rw, streamed_copy};
+    }
+
     template <typename field_type>
     void complex_test(
         const std::vector<std::vector<std::uint8_t>>    &bytecodes,
@@ -283,4 +341,56 @@ BOOST_AUTO_TEST_CASE(calldatacopy) {
 
     complex_test<field_type>(bytecodes, pts, max_sizes);
 }
+
+BOOST_AUTO_TEST_CASE(streamed_trace) {
+    check_streamed_trace("mstore8/");
+}
+
+BOOST_AUTO_TEST_CASE(streamed_trace_storage) {
+    auto [rw_operations, copy_events] = check_streamed_trace("small_stack_storage/");
+    BOOST_CHECK(std::any_of(rw_operations.begin(), rw_operations.end(), [](const nil::blueprint::bbf::rw_operation &op){
+        return op.op == nil::blueprint::bbf::rw_operation_type::storage && op.is_write;
+    }));
+    BOOST_CHECK(std::any_of(rw_operations.begin(), rw_operations.end(), [](const nil::blueprint::bbf::rw_operation &op){
+        return op.op == nil::blueprint::bbf::rw_operation_type::storage && !op.is_write;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(streamed_trace_keccak) {
+    auto [rw_operations, copy_events] = check_streamed_trace("keccak/");
+    BOOST_CHECK(std::any_of(copy_events.begin(), copy_events.end(), [](const nil::blueprint::bbf::copy_event &event){
+        return event.destination_type == nil::blueprint::bbf::copy_operand_type::keccak;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(streamed_trace_errors) {
+    auto read_all = [](const std::string &json){
+        std::istringstream in(json);
+        nil::blueprint::bbf::hardhat_trace_reader reader(in);
+        nil::blueprint::bbf::hardhat_trace_step step;
+        std::size_t steps = 0;
+        while( reader.next(step) ) steps++;
+        return steps;
+    };
+    const std::string step = R"({"depth":1,"gas":100,"op":"PUSH1","pc":0,"memory":[],"stack":["0x1"],"storage":{}})";
+
+    BOOST_CHECK_EQUAL(read_all(R"({"result":{"structLogs":[)" + step + "," + step + "]}}"), 2);
+    BOOST_CHECK_EQUAL(read_all(R"({"structLogs":[]})"), 0);
+
+    // Missing structLogs
+    BOOST_CHECK_THROW(read_all(R"({"result":{"failed":false,"gas":0}})"), std::runtime_error);
+    BOOST_CHECK_THROW(read_all("{}"), std::runtime_error);
+    // Truncated
+    BOOST_CHECK_THROW(read_all(""), std::runtime_error);
+    BOOST_CHECK_THROW(read_all(R"({"result":{"structLogs":[)" + step + ","), std::runtime_error);
+    BOOST_CHECK_THROW(read_all(R"({"result":{"structLogs":[)" + step.substr(0, 40)), std::runtime_error);
+    // Malformed
+    BOOST_CHECK_THROW(read_all(R"({"structLogs":[{"op" "PUSH1"}]})"), std::runtime_error);
+    BOOST_CHECK_THROW(read_all(R"({"structLogs":[{"op":"PUSH1","stack":["0x1" "0x2"]}]})"), std::runtime_error);
+    BOOST_CHECK_THROW(read_all(R"({"structLogs":[{"op":"PUSH1","stack":["0x)" + std::string(65, '1') + R"("]}]})"), std::runtime_error);
+
+    std::vector<std::string> missing_trace = {std::string(TEST_DATA_DIR) + "mstore8/missing_trace.json"};
+    BOOST_CHECK_THROW(nil::blueprint::bbf::zkevm_hardhat_input_generator({}, missing_trace), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -25,6 +25,8 @@
 #define BOOST_TEST_MODULE blueprint_plonk_rw_test
 #define PROFILING_ENABLED
 
+#include <random>
+
 #include <boost/test/unit_test.hpp>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
@@ -101,4 +103,33 @@ BOOST_AUTO_TEST_CASE(meminit){
 BOOST_AUTO_TEST_CASE(calldatacopy){
     test_zkevm_rw<field_type>("calldatacopy/", 10000);
 }
+
+BOOST_AUTO_TEST_CASE(radix_sorted_operations){
+    using nil::blueprint::bbf::rw_operation;
+    using nil::blueprint::bbf::rw_operation_type;
+
+    // Few distinct fields so that many operations share a prefix of the key, value keeps the original position
+    std::mt19937_64 gen(1);
+    std::vector<rw_operation> rw_ops;
+    for( std::size_t i = 0; i < 100000; i++ ){
+        rw_operation rw_op = nil::blueprint::bbf::start_rw_operation();
+        rw_op.op = rw_operation_type(gen() % 4);
+        rw_op.call_id = gen() % 3;
+        rw_op.address = zkevm_word_type(gen() % 5) << (64 * (gen() % 4));
+        rw_op.field = gen() % 2;
+        rw_op.storage_key = zkevm_word_type(gen() % 3) << 192;
+        rw_op.rw_counter = gen() % 100;
+        rw_op.value = i;
+        rw_ops.push_back(rw_op);
+    }
+
+    std::vector<rw_operation> expected = rw_ops;
+    std::stable_sort(expected.begin(), expected.end());
+    nil::blueprint::bbf::sort_rw_operations(rw_ops);
+
+    BOOST_CHECK_EQUAL(rw_ops.size(), expected.size());
+    for( std::size_t i = 0; i < rw_ops.size(); i++ ){
+        BOOST_CHECK(rw_ops[i].value == expected[i].value);
+    }
+}
 BOOST_AUTO_TEST_SUITE_END()
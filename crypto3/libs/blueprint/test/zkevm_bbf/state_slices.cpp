@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Elena Tatuzova   <e.tatuzova@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE blueprint_zkevm_state_slices_test
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/blueprint/zkevm_bbf/types/zkevm_state_slices.hpp>
+
+using namespace nil::blueprint::bbf;
+
+using test_slice = paged_slice<std::uint8_t, 4>;
+using test_map_slice = shared_map_slice<std::uint32_t, std::uint32_t>;
+using test_map = test_map_slice::map_type;
+
+BOOST_AUTO_TEST_SUITE(blueprint_zkevm_state_slices_test_suite)
+
+BOOST_AUTO_TEST_CASE(paged_slice_copy_on_write) {
+    test_slice original;
+    original.assign(std::vector<std::uint8_t>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    test_slice copy = original;
+    BOOST_CHECK(copy.shares_page(original, 0));
+    copy.set(1, 20);
+    copy.push_back(10);
+    copy.set(12, 13);
+
+    BOOST_CHECK(original.to_vector() == std::vector<std::uint8_t>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    BOOST_CHECK(copy.to_vector() == std::vector<std::uint8_t>({1, 20, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0, 13}));
+    BOOST_CHECK(!copy.shares_page(original, 0));
+    BOOST_CHECK(copy.shares_page(original, 4));
+    BOOST_CHECK(!copy.shares_page(original, 8));
+
+    copy.pop_back();
+    copy.resize(2);
+    BOOST_CHECK_EQUAL(original.size(), 9);
+    BOOST_CHECK_EQUAL(original[8], 9);
+}
+
+BOOST_AUTO_TEST_CASE(paged_slice_set_equal_value_keeps_page_shared) {
+    test_slice original;
+    original.assign(std::vector<std::uint8_t>{1, 2, 3, 4, 5});
+
+    test_slice copy = original;
+    copy.set(2, 3);
+    copy.set(4, 5);
+    BOOST_CHECK(copy.shares_page(original, 0));
+    BOOST_CHECK(copy.shares_page(original, 4));
+
+    // Writing zero where nothing was written yet does not allocate a page either.
+    copy.set(6, 0);
+    BOOST_CHECK_EQUAL(copy.size(), 7);
+    BOOST_CHECK(copy.shares_page(original, 4));
+}
+
+BOOST_AUTO_TEST_CASE(paged_slice_resize_zeroes_cut_values) {
+    test_slice slice;
+    slice.assign(std::vector<std::uint8_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    test_slice copy = slice;
+
+    slice.resize(6);
+    BOOST_CHECK_EQUAL(slice[7], 0);
+    slice.resize(10);
+    BOOST_CHECK(slice.to_vector() == std::vector<std::uint8_t>({1, 2, 3, 4, 5, 6, 0, 0, 0, 0}));
+
+    slice.resize(1);
+    slice.resize(5);
+    BOOST_CHECK(slice.to_vector() == std::vector<std::uint8_t>({1, 0, 0, 0, 0}));
+    BOOST_CHECK(copy.to_vector() == std::vector<std::uint8_t>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    slice.resize(0);
+    BOOST_CHECK(slice.empty());
+    slice.resize(3);
+    BOOST_CHECK(slice.to_vector() == std::vector<std::uint8_t>({0, 0, 0}));
+}
+
+BOOST_AUTO_TEST_CASE(paged_slice_assign_matches_to_vector) {
+    const std::vector<std::vector<std::uint8_t>> states = {
+        {},
+        {1, 2, 3},
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+        {1, 2, 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13},
+        {0, 0, 0, 0, 5},
+        {7, 7},
+    };
+
+    test_slice slice;
+    std::vector<test_slice> history;
+    for (const auto &state : states) {
+        slice.assign(state);
+        BOOST_CHECK(slice.to_vector() == state);
+        history.push_back(slice);
+    }
+    for (std::size_t i = 0; i < states.size(); i++) {
+        BOOST_CHECK(history[i].to_vector() == states[i]);
+    }
+
+    // Assigning the same values again keeps every page shared.
+    test_slice copy = history[3];
+    copy.assign(states[3]);
+    for (std::size_t i = 0; i < states[3].size(); i += 4) {
+        BOOST_CHECK(copy.shares_page(history[3], i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shared_map_slice_copy_on_write) {
+    test_map_slice original;
+    original.set(1, 10);
+    original.set(2, 20);
+
+    test_map_slice copy = original;
+    copy.set(1, 10);
+    BOOST_CHECK(copy.shares_map(original));
+
+    copy.set(2, 21);
+    copy.set(3, 30);
+    BOOST_CHECK(!copy.shares_map(original));
+    BOOST_CHECK(original.to_map() == test_map({{1, 10}, {2, 20}}));
+    BOOST_CHECK(copy.to_map() == test_map({{1, 10}, {2, 21}, {3, 30}}));
+    BOOST_CHECK_EQUAL(original[3], 0);
+    BOOST_CHECK_EQUAL(copy[3], 30);
+}
+
+BOOST_AUTO_TEST_CASE(shared_map_slice_assign_matches_to_map) {
+    const test_map values = {{5, 50}, {6, 60}};
+
+    test_map_slice slice;
+    slice.assign(values);
+    BOOST_CHECK(slice.to_map() == values);
+    BOOST_CHECK_EQUAL(slice.size(), 2);
+
+    test_map_slice copy = slice;
+    copy.assign(values);
+    BOOST_CHECK(copy.shares_map(slice));
+
+    copy.assign({});
+    BOOST_CHECK_EQUAL(copy.size(), 0);
+    BOOST_CHECK_EQUAL(copy[5], 0);
+    BOOST_CHECK(slice.to_map() == values);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
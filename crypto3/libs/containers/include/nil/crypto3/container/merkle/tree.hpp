@@ -230,9 +230,16 @@ namespace nil {
                         set_complete_size(detail::merkle_tree_length(_leaves, Arity));
                     }
 
+                    // Takes the nodes of a complete tree, as returned by begin() and end().
+                    explicit merkle_tree_impl(container_type &&hashes) : _hashes(std::move(hashes)) {
+                        set_leaves(detail::merkle_tree_leaves(_hashes.size(), Arity));
+                        set_row_count(detail::merkle_tree_row_count(_leaves, Arity));
+                        set_complete_size(detail::merkle_tree_length(_leaves, Arity));
+                    }
+
                     merkle_tree_impl(merkle_tree_impl &&x)
                     BOOST_NOEXCEPT(std::is_nothrow_move_constructible<allocator_type>::value):
-                            _hashes(x._hashes),
+                            _hashes(std::move(x._hashes)),
                             _size(x._size), _leaves(x._leaves), _rc(x._rc) {
                     }
 
@@ -246,7 +253,7 @@ namespace nil {
                     }
 
                     merkle_tree_impl &operator=(merkle_tree_impl &&x) {
-                        _hashes = x._hashes;
+                        _hashes = std::move(x._hashes);
                         _size = x._size;
                         _leaves = x._leaves;
                         _rc = x._rc;
@@ -0,0 +1,258 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_MANY_HPP
+#define CRYPTO3_HASH_MANY_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                template<typename T, typename = void>
+                struct is_byte_range : std::false_type { };
+
+                template<typename T>
+                struct is_byte_range<T, std::void_t<decltype(std::begin(std::declval<const T &>()))>>
+                    : std::integral_constant<
+                          bool,
+                          std::is_integral<typename std::decay<decltype(*std::begin(std::declval<const T &>()))>::type>::value &&
+                          sizeof(typename std::decay<decltype(*std::begin(std::declval<const T &>()))>::type) == 1> { };
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes a stream of independent messages and writes their digests to out, in the order the messages
+         * were passed. Hashes which have a multi-lane implementation keep a few messages back and hash them together,
+         * so the digests of the last messages are written only by flush(), which must be called before the output is
+         * used. The messages are copied, so the caller may reuse its buffers right after each call.
+         *
+         * This generic version hashes every message right away, exactly as crypto3::hash does.
+         *
+         * @ingroup hashes
+         */
+        template<typename Hash, typename OutputIterator>
+        class batch_hasher {
+        public:
+            typedef typename Hash::digest_type digest_type;
+
+            constexpr static const std::size_t lanes = 1;
+
+            explicit batch_hasher(OutputIterator out) : out(out) {
+            }
+
+            template<typename Message>
+            void operator()(const Message &message) {
+                *out++ = static_cast<digest_type>(crypto3::hash<Hash>(message));
+            }
+
+            /*!
+             * @brief Hashes a single message made of the parts [first, last), as if they were all passed to one
+             * accumulator. This is how the inner nodes of Merkle trees are hashed.
+             */
+            template<typename PartIterator>
+            void operator()(PartIterator first, PartIterator last) {
+                accumulator_set<Hash> acc;
+                while (first != last) {
+                    crypto3::hash<Hash>(*first++, acc);
+                }
+                *out++ = accumulators::extract::hash<Hash>(acc);
+            }
+
+            OutputIterator flush() {
+                return out;
+            }
+
+        private:
+            OutputIterator out;
+        };
+
+        /*!
+         * @brief Keccak messages which are byte sequences are hashed in groups of lanes, each group running a single
+         * lane-interleaved sponge. Groups of messages with different numbers of blocks, the last incomplete group and
+         * messages of other element types fall back to crypto3::hash.
+         */
+        template<std::size_t DigestBits, typename OutputIterator>
+        class batch_hasher<hashes::keccak_1600<DigestBits>, OutputIterator> {
+            typedef hashes::keccak_1600<DigestBits> hash_type;
+            typedef typename hash_type::policy_type policy_type;
+            typedef typename policy_type::word_type word_type;
+            typedef hashes::detail::keccak_1600_impl<policy_type> impl_type;
+
+            constexpr static const std::size_t rate_bytes = policy_type::block_bits / 8;
+            constexpr static const std::size_t word_bytes = policy_type::word_bits / 8;
+
+        public:
+            typedef typename hash_type::digest_type digest_type;
+
+            // As many states as there are words in a vector register.
+#if defined(__AVX512F__)
+            constexpr static const std::size_t lanes = 8;
+#elif defined(__AVX2__)
+            constexpr static const std::size_t lanes = 4;
+#else
+            constexpr static const std::size_t lanes = 2;
+#endif
+
+            explicit batch_hasher(OutputIterator out) : out(out), pending(0) {
+            }
+
+            template<typename Message>
+            void operator()(const Message &message) {
+                if constexpr (hashes::detail::is_byte_range<Message>::value) {
+                    std::vector<std::uint8_t> &bytes = messages[pending];
+                    bytes.clear();
+                    bytes.insert(bytes.end(), std::begin(message), std::end(message));
+                    push();
+                } else {
+                    hash_pending();
+                    *out++ = static_cast<digest_type>(crypto3::hash<hash_type>(message));
+                }
+            }
+
+            template<typename PartIterator>
+            void operator()(PartIterator first, PartIterator last) {
+                if constexpr (hashes::detail::is_byte_range<
+                                  typename std::iterator_traits<PartIterator>::value_type>::value) {
+                    std::vector<std::uint8_t> &bytes = messages[pending];
+                    bytes.clear();
+                    for (; first != last; ++first) {
+                        bytes.insert(bytes.end(), std::begin(*first), std::end(*first));
+                    }
+                    push();
+                } else {
+                    hash_pending();
+                    accumulator_set<hash_type> acc;
+                    while (first != last) {
+                        crypto3::hash<hash_type>(*first++, acc);
+                    }
+                    *out++ = accumulators::extract::hash<hash_type>(acc);
+                }
+            }
+
+            OutputIterator flush() {
+                hash_pending();
+                return out;
+            }
+
+        private:
+            void push() {
+                if (++pending == lanes) {
+                    hash_pending();
+                }
+            }
+
+            void hash_pending() {
+                if (pending == 0) {
+                    return;
+                }
+
+                // Padding always adds at least one byte.
+                const std::size_t blocks = messages[0].size() / rate_bytes + 1;
+                bool same_blocks = pending == lanes;
+                for (std::size_t l = 1; l < pending && same_blocks; ++l) {
+                    same_blocks = messages[l].size() / rate_bytes + 1 == blocks;
+                }
+
+                if (same_blocks) {
+                    hash_lanes(blocks);
+                } else {
+                    for (std::size_t l = 0; l < pending; ++l) {
+                        *out++ = static_cast<digest_type>(crypto3::hash<hash_type>(messages[l]));
+                    }
+                }
+                pending = 0;
+            }
+
+            void hash_lanes(std::size_t blocks) {
+                for (std::vector<std::uint8_t> &bytes : messages) {
+                    const std::size_t length = bytes.size();
+                    bytes.resize(blocks * rate_bytes, 0);
+                    bytes[length] ^= 0x01;
+                    bytes.back() ^= 0x80;
+                }
+
+                std::array<hashes::detail::keccak_1600_lanes_word<word_type, lanes>, policy_type::state_words> state =
+                    {};
+                for (std::size_t block = 0; block < blocks; ++block) {
+                    for (std::size_t i = 0; i < policy_type::block_words; ++i) {
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            state[i].lanes[l] ^= load_word(messages[l].data() + block * rate_bytes + i * word_bytes);
+                        }
+                    }
+                    impl_type::permute(state);
+                }
+
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    digest_type digest;
+                    for (std::size_t j = 0; j < digest.size(); ++j) {
+                        digest[j] = static_cast<std::uint8_t>(state[j / word_bytes].lanes[l] >> (8 * (j % word_bytes)));
+                    }
+                    *out++ = digest;
+                }
+            }
+
+            // State words are little-endian.
+            static word_type load_word(const std::uint8_t *bytes) {
+                word_type word = 0;
+                for (std::size_t j = 0; j < word_bytes; ++j) {
+                    word |= static_cast<word_type>(bytes[j]) << (8 * j);
+                }
+                return word;
+            }
+
+            OutputIterator out;
+            std::array<std::vector<std::uint8_t>, lanes> messages;
+            std::size_t pending;
+        };
+
+        /*!
+         * @brief Hashes each of the messages [first, last) and writes their digests to out.
+         * @ingroup hashes
+         */
+        template<typename Hash, typename InputIterator, typename OutputIterator>
+        OutputIterator hash_many(InputIterator first, InputIterator last, OutputIterator out) {
+            batch_hasher<Hash, OutputIterator> hasher(out);
+            while (first != last) {
+                hasher(*first++);
+            }
+            return hasher.flush();
+        }
+
+        template<typename Hash, typename SinglePassRange, typename OutputIterator>
+        OutputIterator hash_many(const SinglePassRange &messages, OutputIterator out) {
+            return hash_many<Hash>(std::begin(messages), std::end(messages), out);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_MANY_HPP
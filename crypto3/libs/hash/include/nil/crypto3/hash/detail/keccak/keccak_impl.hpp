@@ -27,12 +27,96 @@
 #ifndef CRYPTO3_KECCAK_IMPL_HPP
 #define CRYPTO3_KECCAK_IMPL_HPP
 
+#include <array>
+
 #include <nil/crypto3/hash/detail/keccak/keccak_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace hashes {
             namespace detail {
+                /*!
+                 * @brief Words of Lanes independent Keccak states at the same position, processed together. With GCC
+                 * and Clang the lanes form a vector type, so every operation is a single SIMD instruction when
+                 * the lanes fit into the vector registers of the target.
+                 */
+                template<typename WordType, std::size_t Lanes>
+                struct keccak_1600_lanes_word {
+                    constexpr static const std::size_t word_bits = sizeof(WordType) * 8;
+
+#ifdef __GNUC__
+                    typedef WordType lanes_type __attribute__((vector_size(Lanes * sizeof(WordType))));
+
+                    keccak_1600_lanes_word operator^(const keccak_1600_lanes_word &other) const {
+                        return {lanes ^ other.lanes};
+                    }
+
+                    keccak_1600_lanes_word operator&(const keccak_1600_lanes_word &other) const {
+                        return {lanes & other.lanes};
+                    }
+
+                    keccak_1600_lanes_word operator~() const {
+                        return {~lanes};
+                    }
+
+                    // Used to add the round constant, which is the same for all the lanes.
+                    keccak_1600_lanes_word &operator^=(WordType c) {
+                        lanes ^= c;
+                        return *this;
+                    }
+
+                    template<std::size_t N>
+                    keccak_1600_lanes_word rotl() const {
+                        return {(lanes << N) | (lanes >> (word_bits - N))};
+                    }
+#else
+                    typedef std::array<WordType, Lanes> lanes_type;
+
+                    keccak_1600_lanes_word operator^(const keccak_1600_lanes_word &other) const {
+                        keccak_1600_lanes_word r;
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            r.lanes[l] = lanes[l] ^ other.lanes[l];
+                        }
+                        return r;
+                    }
+
+                    keccak_1600_lanes_word operator&(const keccak_1600_lanes_word &other) const {
+                        keccak_1600_lanes_word r;
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            r.lanes[l] = lanes[l] & other.lanes[l];
+                        }
+                        return r;
+                    }
+
+                    keccak_1600_lanes_word operator~() const {
+                        keccak_1600_lanes_word r;
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            r.lanes[l] = ~lanes[l];
+                        }
+                        return r;
+                    }
+
+                    keccak_1600_lanes_word &operator^=(WordType c) {
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            lanes[l] ^= c;
+                        }
+                        return *this;
+                    }
+
+                    template<std::size_t N>
+                    keccak_1600_lanes_word rotl() const {
+                        keccak_1600_lanes_word r;
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            r.lanes[l] = (lanes[l] << N) | (lanes[l] >> (word_bits - N));
+                        }
+                        return r;
+                    }
+#endif
+
+                    // lanes[l] is the word of the l-th state.
+                    lanes_type lanes;
+                };
+
                 template< typename PolicyType>
                 struct keccak_1600_impl {
                     typedef PolicyType policy_type;
@@ -56,44 +140,72 @@ namespace nil {
                         UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)};
 
                     static inline void permute(state_type &A) {
+                        permute_state(A);
+                    }
+
+                    /*!
+                     * @brief Permutes the states of Lanes independent instances at once, the l-th lane of A[i] holds
+                     * the i-th word of the l-th state.
+                     */
+                    template<std::size_t Lanes>
+                    static inline void permute(std::array<keccak_1600_lanes_word<word_type, Lanes>, 25> &A) {
+                        permute_state(A);
+                    }
+
+                private:
+                    template<std::size_t N>
+                    static inline word_type rotl(word_type x) {
+                        return policy_type::template rotl<N>(x);
+                    }
+
+                    template<std::size_t N, std::size_t Lanes>
+                    static inline keccak_1600_lanes_word<word_type, Lanes>
+                        rotl(const keccak_1600_lanes_word<word_type, Lanes> &x) {
+                        return x.template rotl<N>();
+                    }
+
+                    template<typename StateType>
+                    static inline void permute_state(StateType &A) {
+                        typedef typename StateType::value_type state_word_type;
+
                         for (typename round_constants_type::value_type c : round_constants) {
-                            const word_type C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
-                            const word_type C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
-                            const word_type C2 = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
-                            const word_type C3 = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
-                            const word_type C4 = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
-
-                            const word_type D0 = policy_type::template rotl<1>(C0) ^ C3;
-                            const word_type D1 = policy_type::template rotl<1>(C1) ^ C4;
-                            const word_type D2 = policy_type::template rotl<1>(C2) ^ C0;
-                            const word_type D3 = policy_type::template rotl<1>(C3) ^ C1;
-                            const word_type D4 = policy_type::template rotl<1>(C4) ^ C2;
-
-                            const word_type B00 = A[0] ^ D1;
-                            const word_type B10 = policy_type::template rotl<1>(A[1] ^ D2);
-                            const word_type B20 = policy_type::template rotl<62>(A[2] ^ D3);
-                            const word_type B05 = policy_type::template rotl<28>(A[3] ^ D4);
-                            const word_type B15 = policy_type::template rotl<27>(A[4] ^ D0);
-                            const word_type B16 = policy_type::template rotl<36>(A[5] ^ D1);
-                            const word_type B01 = policy_type::template rotl<44>(A[6] ^ D2);
-                            const word_type B11 = policy_type::template rotl<6>(A[7] ^ D3);
-                            const word_type B21 = policy_type::template rotl<55>(A[8] ^ D4);
-                            const word_type B06 = policy_type::template rotl<20>(A[9] ^ D0);
-                            const word_type B07 = policy_type::template rotl<3>(A[10] ^ D1);
-                            const word_type B17 = policy_type::template rotl<10>(A[11] ^ D2);
-                            const word_type B02 = policy_type::template rotl<43>(A[12] ^ D3);
-                            const word_type B12 = policy_type::template rotl<25>(A[13] ^ D4);
-                            const word_type B22 = policy_type::template rotl<39>(A[14] ^ D0);
-                            const word_type B23 = policy_type::template rotl<41>(A[15] ^ D1);
-                            const word_type B08 = policy_type::template rotl<45>(A[16] ^ D2);
-                            const word_type B18 = policy_type::template rotl<15>(A[17] ^ D3);
-                            const word_type B03 = policy_type::template rotl<21>(A[18] ^ D4);
-                            const word_type B13 = policy_type::template rotl<8>(A[19] ^ D0);
-                            const word_type B14 = policy_type::template rotl<18>(A[20] ^ D1);
-                            const word_type B24 = policy_type::template rotl<2>(A[21] ^ D2);
-                            const word_type B09 = policy_type::template rotl<61>(A[22] ^ D3);
-                            const word_type B19 = policy_type::template rotl<56>(A[23] ^ D4);
-                            const word_type B04 = policy_type::template rotl<14>(A[24] ^ D0);
+                            const state_word_type C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
+                            const state_word_type C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
+                            const state_word_type C2 = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
+                            const state_word_type C3 = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
+                            const state_word_type C4 = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
+
+                            const state_word_type D0 = rotl<1>(C0) ^ C3;
+                            const state_word_type D1 = rotl<1>(C1) ^ C4;
+                            const state_word_type D2 = rotl<1>(C2) ^ C0;
+                            const state_word_type D3 = rotl<1>(C3) ^ C1;
+                            const state_word_type D4 = rotl<1>(C4) ^ C2;
+
+                            const state_word_type B00 = A[0] ^ D1;
+                            const state_word_type B10 = rotl<1>(A[1] ^ D2);
+                            const state_word_type B20 = rotl<62>(A[2] ^ D3);
+                            const state_word_type B05 = rotl<28>(A[3] ^ D4);
+                            const state_word_type B15 = rotl<27>(A[4] ^ D0);
+                            const state_word_type B16 = rotl<36>(A[5] ^ D1);
+                            const state_word_type B01 = rotl<44>(A[6] ^ D2);
+                            const state_word_type B11 = rotl<6>(A[7] ^ D3);
+                            const state_word_type B21 = rotl<55>(A[8] ^ D4);
+                            const state_word_type B06 = rotl<20>(A[9] ^ D0);
+                            const state_word_type B07 = rotl<3>(A[10] ^ D1);
+                            const state_word_type B17 = rotl<10>(A[11] ^ D2);
+                            const state_word_type B02 = rotl<43>(A[12] ^ D3);
+                            const state_word_type B12 = rotl<25>(A[13] ^ D4);
+                            const state_word_type B22 = rotl<39>(A[14] ^ D0);
+                            const state_word_type B23 = rotl<41>(A[15] ^ D1);
+                            const state_word_type B08 = rotl<45>(A[16] ^ D2);
+                            const state_word_type B18 = rotl<15>(A[17] ^ D3);
+                            const state_word_type B03 = rotl<21>(A[18] ^ D4);
+                            const state_word_type B13 = rotl<8>(A[19] ^ D0);
+                            const state_word_type B14 = rotl<18>(A[20] ^ D1);
+                            const state_word_type B24 = rotl<2>(A[21] ^ D2);
+                            const state_word_type B09 = rotl<61>(A[22] ^ D3);
+                            const state_word_type B19 = rotl<56>(A[23] ^ D4);
+                            const state_word_type B04 = rotl<14>(A[24] ^ D0);
 
                             A[0] = B00 ^ (~B01 & B02);
                             A[1] = B01 ^ (~B02 & B03);
@@ -22,7 +22,12 @@
 #include <nil/crypto3/hash/detail/poseidon/kimchi_constants.hpp>
 
 #include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+
+#include <array>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -68,6 +73,172 @@ namespace nil {
 
                     mds_matrix_type mds_matrix;
                 };
+
+                /*!
+                 * @brief Constants of the original version rearranged for the fast permutation, as described in
+                 * the appendix B of the Poseidon paper. The permutation result is the same as with poseidon_constants.
+                 *
+                 * The matrices here are applied to a column state vector, new_state[i] = sum_j m[i][j] * state[j].
+                 *
+                 * Only the first state word goes through the S-box of a partial round, so the constants added to
+                 * the other words are carried through the MDS matrices of the following partial rounds and added
+                 * in the first full round after them. Each partial round adds a single constant.
+                 *
+                 * The matrix M of a partial round is factored as M = S * B, where B = diag(1, M') for the minor M'
+                 * of M without its first row and column, and S differs from the identity in its first row and
+                 * column only. B commutes with the S-box of a partial round, so it is moved to the previous round,
+                 * which multiplies by B * MDS. The partial rounds multiply by sparse matrices S only, and the last
+                 * full round before them uses pre_sparse_matrix.
+                 */
+                template<typename PolicyType>
+                class poseidon_optimized_constants {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef poseidon_constants<policy_type> poseidon_constants_type;
+                    typedef typename poseidon_constants_type::constants_data_type constants_data_type;
+
+                    typedef typename poseidon_constants_type::element_type element_type;
+                    typedef typename poseidon_constants_type::state_vector_type state_vector_type;
+                    typedef typename poseidon_constants_type::mds_matrix_type mds_matrix_type;
+                    typedef typename poseidon_constants_type::round_constants_type round_constants_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+
+                    BOOST_STATIC_ASSERT_MSG(!policy_type::mina_version,
+                                            "Optimized constants are defined for the original version only.");
+                    BOOST_STATIC_ASSERT_MSG(part_rounds == 0 || half_full_rounds > 0,
+                                            "Partial rounds must follow a full round.");
+
+                    // First row and first column, the rest is the identity. column[0] is not used.
+                    struct sparse_matrix_type {
+                        state_vector_type row;
+                        state_vector_type column;
+                    };
+
+                    poseidon_optimized_constants() {
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                mds_matrix[i][j] = constants_data_type::mds_matrix[i][j];
+                            }
+                        }
+                        for (std::size_t r = 0; r < full_rounds + part_rounds; r++) {
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                round_constants[r][i] = constants_data_type::round_constants[r][i];
+                            }
+                        }
+                        pre_sparse_matrix = mds_matrix;
+
+                        if constexpr (part_rounds > 0) {
+                            // Factor the matrices from the last partial round to the first one, each round but the
+                            // last one gets B of the next round merged into its matrix.
+                            std::vector<mds_matrix_type> moved_matrices(part_rounds);
+                            mds_matrix_type m = mds_matrix;
+                            for (std::size_t p = part_rounds; p-- > 0;) {
+                                minor_matrix_type minor;
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    for (std::size_t j = 1; j < state_words; j++) {
+                                        minor[i - 1][j - 1] = m[i][j];
+                                    }
+                                }
+                                const minor_matrix_type minor_inverse = inverse(minor);
+
+                                sparse_matrix_type &sparse = sparse_matrices[p];
+                                sparse.row[0] = m[0][0];
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    sparse.row[j] = element_type::zero();
+                                    for (std::size_t k = 1; k < state_words; k++) {
+                                        sparse.row[j] += m[0][k] * minor_inverse[k - 1][j - 1];
+                                    }
+                                    sparse.column[j] = m[j][0];
+                                }
+
+                                mds_matrix_type &moved = moved_matrices[p];
+                                moved = algebra::get_identity<element_type, state_words>();
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    for (std::size_t j = 1; j < state_words; j++) {
+                                        moved[i][j] = m[i][j];
+                                    }
+                                }
+                                m = algebra::matmul(moved, mds_matrix);
+                            }
+                            pre_sparse_matrix = m;
+
+                            // Partial round constants pass through the moved matrices as well.
+                            state_vector_type carry;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                carry[i] = element_type::zero();
+                            }
+                            for (std::size_t p = 0; p < part_rounds; p++) {
+                                const element_type *constants = round_constants[half_full_rounds + p];
+                                state_vector_type sum = carry;
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    for (std::size_t j = 0; j < state_words; j++) {
+                                        sum[i] += moved_matrices[p][i][j] * constants[j];
+                                    }
+                                }
+                                part_round_constants[p] = sum[0];
+
+                                // The sparse matrix applied to sum without its first word.
+                                carry[0] = element_type::zero();
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    carry[0] += sparse_matrices[p].row[j] * sum[j];
+                                    carry[j] = sum[j];
+                                }
+                            }
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                round_constants[half_full_rounds + part_rounds][i] += carry[i];
+                            }
+                        }
+                    }
+
+                    mds_matrix_type mds_matrix;
+                    mds_matrix_type pre_sparse_matrix;
+                    // Rows of the partial rounds are not used.
+                    round_constants_type round_constants;
+                    std::array<element_type, part_rounds> part_round_constants;
+                    std::array<sparse_matrix_type, part_rounds> sparse_matrices;
+
+                private:
+                    typedef algebra::matrix<element_type, state_words - 1, state_words - 1> minor_matrix_type;
+
+                    // Gauss-Jordan elimination. Minors of an MDS matrix are never singular.
+                    static minor_matrix_type inverse(minor_matrix_type m) {
+                        constexpr std::size_t size = state_words - 1;
+                        minor_matrix_type result = algebra::get_identity<element_type, size>();
+                        for (std::size_t col = 0; col < size; col++) {
+                            std::size_t pivot = col;
+                            while (pivot < size && m[pivot][col].is_zero()) {
+                                pivot++;
+                            }
+                            BOOST_ASSERT_MSG(pivot < size, "Poseidon MDS matrix minor is singular.");
+                            if (pivot != col) {
+                                for (std::size_t j = 0; j < size; j++) {
+                                    std::swap(m[pivot][j], m[col][j]);
+                                    std::swap(result[pivot][j], result[col][j]);
+                                }
+                            }
+                            const element_type scale = m[col][col].inversed();
+                            for (std::size_t j = 0; j < size; j++) {
+                                m[col][j] *= scale;
+                                result[col][j] *= scale;
+                            }
+                            for (std::size_t i = 0; i < size; i++) {
+                                if (i == col || m[i][col].is_zero()) {
+                                    continue;
+                                }
+                                const element_type factor = m[i][col];
+                                for (std::size_t j = 0; j < size; j++) {
+                                    m[i][j] -= factor * m[col][j];
+                                    result[i][j] -= factor * result[col][j];
+                                }
+                            }
+                        }
+                        return result;
+                    }
+                };
             }    // namespace detail
         }        // namespace hashes
     }            // namespace crypto3
@@ -49,6 +49,12 @@ namespace nil {
                         permutation_type::permute(state);
                     }
 
+                    // Permutes independent states, see poseidon_permutation::permute_many.
+                    template<typename StateRange>
+                    static void permute_many(StateRange& states) {
+                        permutation_type::permute_many(states);
+                    }
+
                     static void absorb(const block_type block, state_type& state) {
                         for (std::size_t i = 0; i < block_words; ++i) {
                             state[i] += block[i];
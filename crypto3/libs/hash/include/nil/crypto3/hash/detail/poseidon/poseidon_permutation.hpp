@@ -11,8 +11,12 @@
 #define CRYPTO3_HASH_POSEIDON_FUNCTIONS_HPP
 
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
 
+#include <array>
+#include <iterator>
+
 namespace nil {
     namespace crypto3 {
         namespace hashes {
@@ -39,33 +43,161 @@ namespace nil {
                     constexpr static const std::size_t word_bits = policy_type::word_bits;
                     typedef typename policy_type::word_type word_type;
 
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
+                    // Number of states permute_many() runs together. Rounds of independent states do not depend on
+                    // each other, so the field operations of one state overlap with the ones of the others.
+                    constexpr static const std::size_t interleaved_states = 4;
+
                     static inline void permute(state_type &A) {
-                        std::size_t round_number = 0;
+                        state_type *states[1] = {&A};
+                        permute_interleaved(states, 1);
+                    }
 
-                        // Converting from std::array to algebra::vector here.
-                        state_vector_type A_vector;
-                        for (std::size_t i = 0; i < state_words; i++) {
-                            A_vector[i] = A[i];
+                    /*!
+                     * @brief Permutes each of the states [first, last) in place, interleaving the rounds of groups of
+                     * interleaved_states states. The result is the same as of calling permute() for each state.
+                     */
+                    template<typename StateIterator>
+                    static inline void permute_many(StateIterator first, StateIterator last) {
+                        std::array<state_type *, interleaved_states> states;
+                        while (first != last) {
+                            std::size_t size = 0;
+                            for (; size < interleaved_states && first != last; ++first) {
+                                states[size++] = &*first;
+                            }
+                            permute_interleaved(states.data(), size);
                         }
+                    }
+
+                    template<typename StateRange>
+                    static inline void permute_many(StateRange &states) {
+                        permute_many(std::begin(states), std::end(states));
+                    }
 
-                        // first half of full rounds
-                        for (std::size_t i = 0; i < half_full_rounds; i++) {
-                            round_operator_type::full_round(A_vector, round_number++);
+                private:
+                    // Not instantiated for the Mina version.
+                    typedef poseidon_optimized_constants<policy_type> optimized_constants_type;
+                    typedef typename poseidon_constants<policy_type>::mds_matrix_type mds_matrix_type;
+
+                    static inline void permute_interleaved(state_type *const *states, std::size_t size) {
+                        if constexpr (policy_type::mina_version) {
+                            std::size_t round_number = 0;
+
+                            // Converting from std::array to algebra::vector here.
+                            std::array<state_vector_type, interleaved_states> A_vectors;
+                            for (std::size_t s = 0; s < size; s++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    A_vectors[s][i] = (*states[s])[i];
+                                }
+                            }
+
+                            // first half of full rounds
+                            for (std::size_t i = 0; i < half_full_rounds; i++, round_number++) {
+                                for (std::size_t s = 0; s < size; s++) {
+                                    round_operator_type::full_round(A_vectors[s], round_number);
+                                }
+                            }
+
+                            // partial rounds
+                            for (std::size_t i = 0; i < part_rounds; i++, round_number++) {
+                                for (std::size_t s = 0; s < size; s++) {
+                                    round_operator_type::part_round(A_vectors[s], round_number);
+                                }
+                            }
+
+                            // second half of full rounds
+                            for (std::size_t i = half_full_rounds; i < full_rounds; i++, round_number++) {
+                                for (std::size_t s = 0; s < size; s++) {
+                                    round_operator_type::full_round(A_vectors[s], round_number);
+                                }
+                            }
+
+                            for (std::size_t s = 0; s < size; s++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    (*states[s])[i] = A_vectors[s][i];
+                                }
+                            }
+                        } else {
+                            const optimized_constants_type &constants = get_optimized_constants();
+                            std::size_t round_number = 0;
+
+                            // first half of full rounds, the last one also applies the moved part of the matrix of
+                            // the first partial round
+                            for (; round_number < half_full_rounds; round_number++) {
+                                full_round(states, size, constants.round_constants[round_number],
+                                           round_number + 1 == half_full_rounds ? constants.pre_sparse_matrix :
+                                                                                  constants.mds_matrix);
+                            }
+
+                            // partial rounds
+                            for (std::size_t i = 0; i < part_rounds; i++, round_number++) {
+                                part_round(states, size, constants.part_round_constants[i],
+                                           constants.sparse_matrices[i]);
+                            }
+
+                            // second half of full rounds
+                            for (; round_number < full_rounds + part_rounds; round_number++) {
+                                full_round(states, size, constants.round_constants[round_number],
+                                           constants.mds_matrix);
+                            }
                         }
+                    }
 
-                        // partial rounds
-                        for (std::size_t i = 0; i < part_rounds; i++) {
-                            round_operator_type::part_round(A_vector, round_number++);
+                    static inline void sbox(element_type &x) {
+                        if constexpr (sbox_power == 5) {
+                            const element_type x2 = x.squared();
+                            x *= x2.squared();
+                        } else {
+                            x = x.pow(sbox_power);
                         }
+                    }
 
-                        // second half of full rounds
-                        for (std::size_t i = half_full_rounds; i < full_rounds; i++) {
-                            round_operator_type::full_round(A_vector, round_number++);
+                    static inline void full_round(state_type *const *states, std::size_t size,
+                                                  const element_type *round_constants,
+                                                  const mds_matrix_type &matrix) {
+                        for (std::size_t s = 0; s < size; s++) {
+                            state_type &A = *states[s];
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                A[i] += round_constants[i];
+                                sbox(A[i]);
+                            }
                         }
+                        for (std::size_t s = 0; s < size; s++) {
+                            state_type &A = *states[s];
+                            state_type result;
+                            for (std::size_t i = 0; i < state_words; i++) {
+                                result[i] = matrix[i][0] * A[0];
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    result[i] += matrix[i][j] * A[j];
+                                }
+                            }
+                            A = result;
+                        }
+                    }
 
-                        for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] = A_vector[i];
+                    template<typename SparseMatrix>
+                    static inline void part_round(state_type *const *states, std::size_t size,
+                                                  const element_type &round_constant, const SparseMatrix &matrix) {
+                        for (std::size_t s = 0; s < size; s++) {
+                            state_type &A = *states[s];
+                            A[0] += round_constant;
+                            sbox(A[0]);
                         }
+                        for (std::size_t s = 0; s < size; s++) {
+                            state_type &A = *states[s];
+                            element_type first = matrix.row[0] * A[0];
+                            for (std::size_t i = 1; i < state_words; i++) {
+                                first += matrix.row[i] * A[i];
+                                A[i] += matrix.column[i] * A[0];
+                            }
+                            A[0] = first;
+                        }
+                    }
+
+                    static const optimized_constants_type &get_optimized_constants() {
+                        static const optimized_constants_type constants;
+                        return constants;
                     }
                 };
             }    // namespace detail
@@ -20,8 +20,8 @@ namespace nil {
         namespace hashes {
             namespace detail {
 
-                // TODO(martun): Poseidon paper describes an optimized round, which can work faster when
-                // the Rate is high. Consider implementing it later.
+                // These are the rounds as defined by the Poseidon paper. The permutation of the original version
+                // runs the equivalent optimized rounds instead, see poseidon_optimized_constants.
                 template<typename poseidon_policy_type, typename Enable=void>
                 class poseidon_round_operator;
 
@@ -50,29 +50,31 @@ namespace nil {
                         BOOST_ASSERT_MSG(round_number < half_full_rounds ||
                                              round_number >= half_full_rounds + part_rounds,
                                          "Wrong usage of the full round function of original Poseidon.");
+                        const poseidon_constants_type &constants = get_constants();
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] += get_constants().get_round_constant(round_number, i);
+                            A[i] += constants.get_round_constant(round_number, i);
                             A[i] = A[i].pow(sbox_power);
                         }
-                        get_constants().product_with_mds_matrix(A);
+                        constants.product_with_mds_matrix(A);
                     }
 
                     static void part_round(state_vector_type &A, std::size_t round_number) {
                         BOOST_ASSERT_MSG(round_number >= half_full_rounds &&
                                              round_number < half_full_rounds + part_rounds,
                                          "Wrong usage of the part round function of original Poseidon.");
+                        const poseidon_constants_type &constants = get_constants();
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] += get_constants().get_round_constant(round_number, i);
+                            A[i] += constants.get_round_constant(round_number, i);
                         }
                         A[0] = A[0].pow(sbox_power);
-                        get_constants().product_with_mds_matrix(A);
+                        constants.product_with_mds_matrix(A);
                     }
 
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
-                        static const poseidon_constants<poseidon_policy_type> constants;
+                    static const poseidon_constants_type &get_constants() {
+                        static const poseidon_constants_type constants;
                         return constants;
                     }
                 };
@@ -103,12 +105,13 @@ namespace nil {
                         BOOST_ASSERT_MSG(round_number < half_full_rounds ||
                                              round_number >= half_full_rounds + part_rounds,
                                          "Wrong usage of the Full round function of Mina Poseidon.");
+                        const poseidon_constants_type &constants = get_constants();
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] = A[i].pow(sbox_power);
                         }
-                        get_constants().product_with_mds_matrix(A);
+                        constants.product_with_mds_matrix(A);
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] += get_constants().get_round_constant(round_number, i);
+                            A[i] += constants.get_round_constant(round_number, i);
                         }
                     }
 
@@ -116,18 +119,19 @@ namespace nil {
                         BOOST_ASSERT_MSG(round_number >= half_full_rounds &&
                                              round_number < half_full_rounds + part_rounds,
                                          "Wrong usage of the part round function of Mina Poseidon.");
+                        const poseidon_constants_type &constants = get_constants();
                         A[0] = A[0].pow(sbox_power);
-                        get_constants().product_with_mds_matrix(A);
+                        constants.product_with_mds_matrix(A);
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] += get_constants().get_round_constant(round_number, i);
+                            A[i] += constants.get_round_constant(round_number, i);
                         }
                     }
 
                 private:
                     // Contains all the constants: mds matrix and round constants.
                     // Default constructor selects the right ones.
-                    static const poseidon_constants<poseidon_policy_type> get_constants() {
-                        static const poseidon_constants<poseidon_policy_type> constants;
+                    static const poseidon_constants_type &get_constants() {
+                        static const poseidon_constants_type constants;
                         return constants;
                     }
                 };
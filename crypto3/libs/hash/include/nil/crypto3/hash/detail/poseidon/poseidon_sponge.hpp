@@ -9,6 +9,8 @@
 #ifndef CRYPTO3_HASH_NIL_POSEIDON_SPONGE_HPP
 #define CRYPTO3_HASH_NIL_POSEIDON_SPONGE_HPP
 
+#include <vector>
+
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
 
@@ -89,6 +91,34 @@ namespace nil {
                         return squeeze();
                     }
 
+                    // Writes to out, for each of the words [first, last), what squeeze() would return after absorbing
+                    // that word into a copy of this sponge. The copies of the state are permuted together by
+                    // permute_many(), the sponge itself is not changed.
+                    template<typename InputIterator, typename OutputIterator>
+                    OutputIterator squeeze_after_each(InputIterator first, InputIterator last, OutputIterator out) const {
+                        state_type prefix = state_;
+                        std::size_t prefix_count = state_count_;
+                        if (prefix_count == state_words) {
+                            permutation_type::permute(prefix);
+                            prefix[0] = prefix[state_words - 1];
+                            for (size_t i = 1; i < state_words; ++i) {
+                                prefix[i] = 0u;
+                            }
+                            prefix_count = 1;
+                        }
+
+                        std::vector<state_type> states;
+                        for (; first != last; ++first) {
+                            states.push_back(prefix);
+                            states.back()[prefix_count] = *first;
+                        }
+                        permutation_type::permute_many(states);
+                        for (const state_type &state : states) {
+                            *out++ = state[state_words - 1];
+                        }
+                        return out;
+                    }
+
                     void reset() {
                         state_.fill(0u);
                         state_count_ = 1;
@@ -35,6 +35,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/keccak.hpp>
@@ -482,3 +483,65 @@ BOOST_AUTO_TEST_CASE(keccak_512_preprocessor2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(keccak_hash_many_test_suite)
+
+BOOST_AUTO_TEST_CASE(keccak_256_hash_many_same_length) {
+    typedef hashes::keccak_1600<256> hash_t;
+
+    // Lengths around the 136-byte rate, so that the padding may take a separate block.
+    for (std::size_t length : {0, 1, 64, 135, 136, 137, 271, 272, 300}) {
+        std::vector<std::vector<std::uint8_t>> messages(19, std::vector<std::uint8_t>(length));
+        for (std::size_t i = 0; i < messages.size(); ++i) {
+            for (std::size_t j = 0; j < length; ++j) {
+                messages[i][j] = static_cast<std::uint8_t>(i * 31 + j * 7);
+            }
+        }
+
+        std::vector<hash_t::digest_type> digests(messages.size());
+        hash_many<hash_t>(messages, digests.begin());
+        for (std::size_t i = 0; i < messages.size(); ++i) {
+            BOOST_CHECK_EQUAL(std::to_string(digests[i]),
+                              std::to_string(static_cast<hash_t::digest_type>(hash<hash_t>(messages[i]))));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(keccak_256_hash_many_mixed_length) {
+    typedef hashes::keccak_1600<256> hash_t;
+
+    std::vector<std::string> messages = {"", "abc", "", "abc", "", "", "", "", "abc"};
+    std::vector<hash_t::digest_type> digests(messages.size());
+    hash_many<hash_t>(messages, digests.begin());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        BOOST_CHECK_EQUAL(std::to_string(digests[i]),
+                          messages[i].empty() ?
+                              "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470" :
+                              "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(keccak_256_batch_hasher_parts) {
+    typedef hashes::keccak_1600<256> hash_t;
+
+    std::vector<hash_t::digest_type> children(16);
+    for (std::size_t i = 0; i < children.size(); ++i) {
+        children[i] = hash<hash_t>(std::vector<std::uint8_t>(i, 0x61));
+    }
+
+    std::vector<hash_t::digest_type> parents(children.size() / 2);
+    batch_hasher<hash_t, std::vector<hash_t::digest_type>::iterator> hasher(parents.begin());
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+        hasher(children.begin() + 2 * i, children.begin() + 2 * i + 2);
+    }
+    hasher.flush();
+
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+        accumulator_set<hash_t> parent_acc;
+        hash<hash_t>(children[2 * i], parent_acc);
+        hash<hash_t>(children[2 * i + 1], parent_acc);
+        BOOST_CHECK_EQUAL(std::to_string(parents[i]), std::to_string(extract::hash<hash_t>(parent_acc)));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -93,6 +93,13 @@ void test_poseidon_permutation(
         typename poseidon_policy<FieldType, 128, Rate>::state_type expected_result) {
     using policy = poseidon_policy<FieldType, 128, Rate>;
 
+    // Interleaved permutation of a full group and an incomplete one must give the same results.
+    std::vector<typename policy::state_type> states(poseidon_permutation<policy>::interleaved_states + 1, input);
+    poseidon_permutation<policy>::permute_many(states);
+    for (const auto &state: states) {
+        BOOST_CHECK_EQUAL(state, expected_result);
+    }
+
     // This permutes in place.
     poseidon_permutation<policy>::permute(input);
     BOOST_CHECK_EQUAL(input, expected_result);
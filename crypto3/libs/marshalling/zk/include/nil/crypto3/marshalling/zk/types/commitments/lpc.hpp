@@ -326,7 +326,7 @@ namespace nil {
                         filled_batch_fixed_values,
                         fill_commitment_preprocessed_data<Endianness, LPCScheme>(scheme.get_fixed_polys_values()),
                         fill_polys_evaluator<Endianness, typename LPCScheme::polys_evaluator_type>(
-                            static_cast<typename LPCScheme::polys_evaluator_type>(scheme))
+                            static_cast<const typename LPCScheme::polys_evaluator_type&>(scheme))
                     ));
                 }
 
@@ -377,7 +377,7 @@ namespace nil {
                         std::get<7>(filled_commitment_scheme.value())
                         );
 
-                    return LPCScheme(evaluator, trees, fri_params, etha, batch_fixed, fixed_polys_values);
+                    return LPCScheme(std::move(evaluator), std::move(trees), fri_params, etha, batch_fixed, fixed_polys_values);
                 }
 
                 template <typename TTypeBase, typename LPCScheme>
@@ -593,6 +593,37 @@ namespace nil {
                     return x_index;
                 }
 
+                /*
+                 * Index of the query point challenge^((p - 1) / |D_0|) in D[0]. The point lies in the subgroup of order
+                 * |D_0| = 2^k, so its discrete logarithm base omega is found bit by bit from the lowest one: once the
+                 * known lower bits are divided out, raising the point to 2^(k - 1 - bit) gives -1 iff the bit is set.
+                 * Returns |D_0| if the point is not in D[0], which only happens for a zero challenge.
+                 */
+                template<typename FRI>
+                static std::uint64_t get_query_index(const typename FRI::field_type::value_type &challenge,
+                                                     const typename FRI::params_type &fri_params) {
+                    typedef typename FRI::field_type::value_type value_type;
+
+                    const std::size_t domain_size = fri_params.D[0]->size();
+                    const std::size_t log_domain_size = static_cast<std::size_t>(std::log2(domain_size));
+                    value_type x = challenge.pow((FRI::field_type::modulus - 1) / domain_size);
+                    value_type omega_power_inverse = fri_params.D[0]->get_domain_element(1).inversed();
+
+                    std::uint64_t x_index = 0;
+                    for (std::size_t bit = 0; bit < log_domain_size; bit++) {
+                        value_type x_power = x;
+                        for (std::size_t i = bit + 1; i < log_domain_size; i++) {
+                            x_power = x_power.squared();
+                        }
+                        if (x_power != value_type::one()) {
+                            x_index |= std::uint64_t(1) << bit;
+                            x *= omega_power_inverse;
+                        }
+                        omega_power_inverse = omega_power_inverse.squared();
+                    }
+                    return x == value_type::one() ? x_index : domain_size;
+                }
+
                 template<typename FRI>
                 static inline bool check_step_list(const typename FRI::params_type &fri_params) {
                     if (fri_params.step_list.empty()) {
@@ -983,15 +1014,8 @@ namespace nil {
                     typename FRI::round_proofs_batch_type proof;
 
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
-
-                        std::uint64_t x_index = 0;
-
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(challenges[query_id], fri_params);
+                        BOOST_ASSERT(x_index < fri_params.D[0]->size());
 
                         // Fill round proofs
                         std::vector<typename FRI::round_proof_type> round_proofs =
@@ -1020,15 +1044,8 @@ namespace nil {
                         convert_polynomials_to_coefficients<FRI, PolynomialType>(fri_params, g);
 
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
-
-                        std::uint64_t x_index = 0;
-
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(challenges[query_id], fri_params);
+                        BOOST_ASSERT(x_index < fri_params.D[0]->size());
 
                         std::map<std::size_t, typename FRI::initial_proof_type>
                             initial_proof = build_initial_proof<FRI, PolynomialType>(
@@ -1201,13 +1218,11 @@ namespace nil {
 
                         std::size_t domain_size = fri_params.D[0]->size();
                         std::size_t coset_size = 1 << fri_params.step_list[0];
-                        typename FRI::field_type::value_type x_challenge = transcript.template challenge<typename FRI::field_type>();
-                        typename FRI::field_type::value_type x = x_challenge.pow((FRI::field_type::modulus - 1)/domain_size);
-                        std::uint64_t x_index = 0;
-                        for( x_index = 0; x_index < domain_size; x_index++ ){
-                            if( fri_params.D[0]->get_domain_element(x_index) == x ){
-                                break;
-                            }
+                        typename FRI::field_type::value_type x;
+                        std::uint64_t x_index = get_query_index<FRI>(
+                            transcript.template challenge<typename FRI::field_type>(), fri_params);
+                        if (x_index >= domain_size) {
+                            return false;
                         }
 
                         std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
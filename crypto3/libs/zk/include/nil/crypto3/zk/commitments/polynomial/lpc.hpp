@@ -93,16 +93,16 @@ namespace nil {
                     void set_fixed_polys_values(const preprocessed_data_type& value) {_fixed_polys_values = value;}
 
                     // This constructor is normally used from marshalling, to recover the LPC state from a file.
-                    // Maybe we want the move variant of this constructor.
+                    // Polynomials and trees are the bulk of the state, pass them as rvalues to avoid copying.
                     lpc_commitment_scheme(
-                            const polys_evaluator_type& polys_evaluator,
-                            const std::map<std::size_t, precommitment_type>& trees,
+                            polys_evaluator_type polys_evaluator,
+                            std::map<std::size_t, precommitment_type> trees,
                             const typename fri_type::params_type& fri_params,
                             const value_type& etha,
                             const std::map<std::size_t, bool>& batch_fixed,
                             const preprocessed_data_type& fixed_polys_values)
-                        : polys_evaluator_type(polys_evaluator)
-                        , _trees(trees)
+                        : polys_evaluator_type(std::move(polys_evaluator))
+                        , _trees(std::move(trees))
                         , _fri_params(fri_params)
                         , _etha(etha)
                         , _batch_fixed(batch_fixed)
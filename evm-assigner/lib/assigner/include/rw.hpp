@@ -10,6 +10,7 @@
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/utils/radix_sort.hpp>
 
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
@@ -184,8 +185,16 @@ namespace nil {
                 // rw_id
                 CHUNKS[28], CHUNKS[29]
             };
-            //sort operations
-            std::sort(rw_trace.begin(), rw_trace.end());
+            //sort operations by op, address, field, storage_key, rw_id packed into bytewise comparable keys
+            constexpr std::size_t sort_key_size = 1 + 32 + 1 + 32 + 8;
+            blueprint::sort_by_packed_key<sort_key_size>(rw_trace,
+                [](const rw_operation<BlueprintFieldType>& rw_op, std::uint8_t* key) {
+                    key[0] = rw_op.op;
+                    intx::be::unsafe::store(key + 1, rw_op.address.get_value());
+                    key[33] = rw_op.field;
+                    intx::be::unsafe::store(key + 34, rw_op.storage_key.get_value());
+                    blueprint::pack_big_endian(rw_op.rw_id, 8, key + 66);
+                });
 
             BOOST_LOG_TRIVIAL(debug) << "Num operations = " << rw_trace.size() << "\n";
             for(uint32_t i = 0; i < rw_trace.size(); i++){
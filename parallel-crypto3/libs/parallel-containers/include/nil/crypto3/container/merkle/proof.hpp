@@ -33,12 +33,15 @@
 #endif
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <vector>
 #include <stack>
 
 #include <boost/variant.hpp>
 
 #include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
 #include <nil/crypto3/container/merkle/tree.hpp>
 
 namespace nil {
@@ -150,6 +153,62 @@ namespace nil {
                         return (d == _root);
                     }
 
+                    /**
+                     * Same as proofs[i].validate(leaves[i]) for every i, but the nodes at the same level of all the
+                     * paths are hashed together through batch_hasher. The paths are expected to be of the same length,
+                     * as for trees with the same number of leaves, otherwise they are validated one by one.
+                     */
+                    template<typename Hashable>
+                    static bool validate_many(const std::vector<std::reference_wrapper<const merkle_proof_impl>> &proofs,
+                                              const std::vector<Hashable> &leaves) {
+                        BOOST_ASSERT(proofs.size() == leaves.size());
+                        if (proofs.empty()) {
+                            return true;
+                        }
+
+                        const std::size_t path_length = proofs[0].get()._path.size();
+                        for (const merkle_proof_impl &proof : proofs) {
+                            if (proof._path.size() != path_length) {
+                                for (std::size_t j = 0; j < proofs.size(); ++j) {
+                                    if (!proofs[j].get().validate(leaves[j])) {
+                                        return false;
+                                    }
+                                }
+                                return true;
+                            }
+                        }
+
+                        typedef typename std::vector<value_type>::iterator digest_iterator;
+                        std::vector<value_type> digests(proofs.size()), next_digests(proofs.size());
+                        hash_many<hash_type>(leaves, digests.begin());
+
+                        std::array<value_type, arity> children;
+                        for (std::size_t level = 0; level < path_length; ++level) {
+                            batch_hasher<hash_type, digest_iterator> hasher(next_digests.begin());
+                            for (std::size_t j = 0; j < proofs.size(); ++j) {
+                                const layer_type &layer = proofs[j].get()._path[level];
+                                std::size_t i = 0;
+                                for (; (i < arity - 1) && i == layer[i]._position; ++i) {
+                                    children[i] = layer[i]._hash;
+                                }
+                                children[i] = digests[j];
+                                for (; i < arity - 1; ++i) {
+                                    children[i + 1] = layer[i]._hash;
+                                }
+                                hasher(children.begin(), children.end());
+                            }
+                            hasher.flush();
+                            std::swap(digests, next_digests);
+                        }
+
+                        for (std::size_t j = 0; j < proofs.size(); ++j) {
+                            if (digests[j] != proofs[j].get()._root) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
                     static std::vector<merkle_proof_impl>
                         generate_compressed_proofs(const containers::merkle_tree<NodeType, Arity> &tree,
                                                     std::vector<std::size_t> leaf_idxs) {
@@ -41,6 +41,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -237,9 +238,16 @@ namespace nil {
                         set_complete_size(detail::merkle_tree_length(_leaves, Arity));
                     }
 
+                    // Takes the nodes of a complete tree, as returned by begin() and end().
+                    explicit merkle_tree_impl(container_type &&hashes) : _hashes(std::move(hashes)) {
+                        set_leaves(detail::merkle_tree_leaves(_hashes.size(), Arity));
+                        set_row_count(detail::merkle_tree_row_count(_leaves, Arity));
+                        set_complete_size(detail::merkle_tree_length(_leaves, Arity));
+                    }
+
                     merkle_tree_impl(merkle_tree_impl &&x)
                     BOOST_NOEXCEPT(std::is_nothrow_move_constructible<allocator_type>::value):
-                            _hashes(x._hashes),
+                            _hashes(std::move(x._hashes)),
                             _size(x._size), _leaves(x._leaves), _rc(x._rc) {
                     }
 
@@ -253,7 +261,7 @@ namespace nil {
                     }
 
                     merkle_tree_impl &operator=(merkle_tree_impl &&x) {
-                        _hashes = x._hashes;
+                        _hashes = std::move(x._hashes);
                         _size = x._size;
                         _leaves = x._leaves;
                         _rc = x._rc;
@@ -486,35 +494,79 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
-                template<typename T, std::size_t Arity, typename LeafIterator>
-                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                // The leaves are split into subtrees of consecutive leaves, their amount is the smallest power of
+                // Arity not less than the number of workers. Each worker hashes the leaves and all the inner nodes of
+                // its own subtree, only the few rows above the subtree roots are hashed after all of them are done.
+                // Within a row the hashes are computed by batch_hasher, several of them at once for hashes which
+                // support it.
+                template<typename T, std::size_t Arity, typename LeafGenerator>
+                merkle_tree_impl<T, Arity> make_merkle_tree_by_subtrees(std::size_t leaves_amount,
+                                                                        LeafGenerator for_each_leaf) {
                     typedef T node_type;
                     typedef typename node_type::hash_type hash_type;
-                    typedef typename node_type::value_type value_type;
-                    typedef typename std::iterator_traits<LeafIterator>::value_type leaf_value_type;
+                    typedef typename merkle_tree_impl<T, Arity>::iterator iterator;
 
-                    merkle_tree_impl<T, Arity> ret(std::distance(first, last));
+                    merkle_tree_impl<T, Arity> ret(leaves_amount);
                     ret.resize(ret.complete_size());
 
-                    nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
-                        return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
-                    });
-
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                    const std::size_t pool_size =
+                        ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
+                    std::size_t subtrees_amount = 1;
+                    while (subtrees_amount < pool_size && subtrees_amount * Arity <= leaves_amount) {
+                        subtrees_amount *= Arity;
+                    }
+                    const std::size_t subtree_leaves = leaves_amount / subtrees_amount;
 
-                    std::size_t next_row_start_index = std::distance(first, last);
+                    nil::crypto3::parallel_for(0, subtrees_amount, [&ret, &for_each_leaf, subtree_leaves](std::size_t subtree) {
+                        auto row_begin = ret.begin();
+                        std::size_t row_size = ret.leaves();
+                        std::size_t part_size = subtree_leaves;
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        nil::crypto3::parallel_for(0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
-                            ret[next_row_start_index + index] = generate_hash<hash_type>(
-                                it + index * Arity, it + (index + 1) * Arity);
+                        batch_hasher<hash_type, iterator> leaf_hasher(row_begin + subtree * part_size);
+                        for_each_leaf(subtree * part_size, (subtree + 1) * part_size, [&leaf_hasher](const auto &leaf) {
+                            leaf_hasher(leaf);
                         });
-                        next_row_start_index += row_size;
-                        it += row_size * Arity;
+                        leaf_hasher.flush();
+
+                        while (part_size > 1) {
+                            auto next_row_begin = row_begin + row_size;
+                            part_size /= Arity;
+                            batch_hasher<hash_type, iterator> node_hasher(next_row_begin + subtree * part_size);
+                            for (std::size_t i = subtree * part_size; i < (subtree + 1) * part_size; ++i) {
+                                node_hasher(row_begin + i * Arity, row_begin + (i + 1) * Arity);
+                            }
+                            node_hasher.flush();
+                            row_begin = next_row_begin;
+                            row_size /= Arity;
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+
+                    std::size_t row_start = 0, row_size = ret.leaves();
+                    while (row_size > subtrees_amount) {
+                        row_start += row_size;
+                        row_size /= Arity;
+                    }
+                    for (; row_size > 1; row_size /= Arity) {
+                        batch_hasher<hash_type, iterator> node_hasher(ret.begin() + row_start + row_size);
+                        for (std::size_t i = 0; i < row_size / Arity; ++i) {
+                            node_hasher(ret.begin() + row_start + i * Arity, ret.begin() + row_start + (i + 1) * Arity);
+                        }
+                        node_hasher.flush();
+                        row_start += row_size;
                     }
                     return ret;
                 }
+
+                template<typename T, std::size_t Arity, typename LeafIterator>
+                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                    return make_merkle_tree_by_subtrees<T, Arity>(
+                        std::distance(first, last),
+                        [first](std::size_t begin, std::size_t end, const auto &consume) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                consume(first[i]);
+                            }
+                        });
+                }
             }    // namespace detail
 
             template<typename T, std::size_t Arity>
@@ -530,6 +582,20 @@ namespace nil {
                         Arity>(first, last);
             }
 
+            /**
+             * Builds the tree without keeping all the leaves in memory at once. for_each_leaf(begin, end, consume)
+             * must call consume(leaf) for the leaves with indices [begin, end) in order, leaf may be a buffer which is
+             * reused for the next leaf right after the call. It is called concurrently for disjoint ranges.
+             */
+            template<typename T, std::size_t Arity, typename LeafGenerator>
+            merkle_tree<T, Arity> make_merkle_tree_from_leaf_generator(std::size_t leaves_amount,
+                                                                        LeafGenerator for_each_leaf) {
+                return detail::make_merkle_tree_by_subtrees<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                        detail::merkle_tree_node<T>,
+                        T>::type,
+                        Arity>(leaves_amount, for_each_leaf);
+            }
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
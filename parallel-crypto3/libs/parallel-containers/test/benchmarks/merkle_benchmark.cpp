@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE merkle_benchmark_test
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::containers;
+
+struct F {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>;
+    using keccak_type = hashes::keccak_1600<256>;
+
+    // Leaves of the size of a FRI leaf for a coset of 2 elements of a 256-bit field.
+    static std::vector<std::array<std::uint8_t, 64>> generate_byte_leaves(std::size_t leaves_amount) {
+        std::vector<std::array<std::uint8_t, 64>> leaves(leaves_amount);
+        for (auto &leaf : leaves) {
+            std::generate(leaf.begin(), leaf.end(), []() { return std::rand() % 256; });
+        }
+        return leaves;
+    }
+
+    static std::vector<std::array<typename field_type::value_type, 2>>
+        generate_field_leaves(std::size_t leaves_amount) {
+        std::vector<std::array<typename field_type::value_type, 2>> leaves(leaves_amount);
+        for (auto &leaf : leaves) {
+            leaf = {algebra::random_element<field_type>(), algebra::random_element<field_type>()};
+        }
+        return leaves;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(merkle_benchmark_test_suite, F)
+
+#define KECCAK_MERKLE_BENCHMARK_TEST_CASE(log_size, num_iterations)                        \
+    BENCHMARK_AUTO_TEST_CASE(keccak_merkle_##log_size##_test, num_iterations) {            \
+        auto leaves = generate_byte_leaves(1ul << log_size);                               \
+        items_per_iteration = leaves.size();                                               \
+        items_name = "leaves";                                                             \
+                                                                                           \
+        START_TIMER("keccak_1600<256> merkle tree 2^" #log_size)                           \
+        auto tree = make_merkle_tree<keccak_type, 2>(leaves.begin(), leaves.end());        \
+        STOP_TIMER("keccak_1600<256> merkle tree 2^" #log_size)                            \
+                                                                                           \
+        BOOST_CHECK_EQUAL(tree.size(), 2 * leaves.size() - 1);                             \
+    }
+
+#define POSEIDON_MERKLE_BENCHMARK_TEST_CASE(log_size, num_iterations)                      \
+    BENCHMARK_AUTO_TEST_CASE(poseidon_merkle_##log_size##_test, num_iterations) {          \
+        auto leaves = generate_field_leaves(1ul << log_size);                              \
+        items_per_iteration = leaves.size();                                               \
+        items_name = "leaves";                                                             \
+                                                                                           \
+        START_TIMER("poseidon merkle tree 2^" #log_size)                                   \
+        auto tree = make_merkle_tree<poseidon_type, 2>(leaves.begin(), leaves.end());      \
+        STOP_TIMER("poseidon merkle tree 2^" #log_size)                                    \
+                                                                                           \
+        BOOST_CHECK_EQUAL(tree.size(), 2 * leaves.size() - 1);                             \
+    }
+
+KECCAK_MERKLE_BENCHMARK_TEST_CASE(16, 10)
+KECCAK_MERKLE_BENCHMARK_TEST_CASE(20, 3)
+
+POSEIDON_MERKLE_BENCHMARK_TEST_CASE(12, 5)
+POSEIDON_MERKLE_BENCHMARK_TEST_CASE(16, 3)
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -96,6 +96,28 @@ void testing_validate_template_random_data(std::size_t leaf_number) {
     BOOST_CHECK(!wrong_data_validate);
 }
 
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_validate_many_template_random_data(std::size_t leaf_number, std::size_t proofs_number) {
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+
+    std::vector<merkle_proof<Hash, Arity>> proofs;
+    std::vector<std::array<ValueType, N>> leaves;
+    for (std::size_t i = 0; i < proofs_number; ++i) {
+        std::size_t proof_idx = std::rand() % leaf_number;
+        proofs.emplace_back(tree, proof_idx);
+        leaves.push_back(data[proof_idx]);
+    }
+    std::vector<std::reference_wrapper<const merkle_proof<Hash, Arity>>> proof_refs(proofs.begin(), proofs.end());
+    bool good_validate = merkle_proof<Hash, Arity>::validate_many(proof_refs, leaves);
+
+    std::size_t wrong_idx = std::rand() % proofs_number;
+    leaves[wrong_idx] = data[(proofs[wrong_idx].leaf_index() + 1) % leaf_number];
+    bool wrong_leaf_validate = merkle_proof<Hash, Arity>::validate_many(proof_refs, leaves);
+    BOOST_CHECK(good_validate);
+    BOOST_CHECK(!wrong_leaf_validate);
+}
+
 template<typename Hash, size_t Arity, typename Element>
 void testing_validate_template(std::vector<Element> data) {
     std::array<uint8_t, 7> data_not_in_tree = {'\x6d', '\x65', '\x73', '\x73', '\x61', '\x67', '\x65'};
@@ -319,6 +341,14 @@ BOOST_AUTO_TEST_CASE(merkletree_validate_test_1) {
     testing_validate_template_random_data<poseidon_type, 2, poseidon_type::word_type, 1>(leaf_number);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_validate_many_test) {
+    // More proofs than Keccak lanes, so that both the batched and the leftover paths are taken.
+    testing_validate_many_template_random_data<hashes::keccak_1600<256>, 2, std::uint8_t, 64>(64, 11);
+    testing_validate_many_template_random_data<hashes::keccak_1600<256>, 4, std::uint8_t, 200>(256, 11);
+    testing_validate_many_template_random_data<hashes::sha2<256>, 2, std::uint8_t, 32>(16, 5);
+    testing_validate_many_template_random_data<poseidon_type, 2, poseidon_type::word_type, 1>(16, 5);
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_validate_test_2) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}, {'8'}};
     testing_validate_template<hashes::sha2<256>, 3>(v);
@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_MATH_BATCH_INVERSE_HPP
+#define PARALLEL_CRYPTO3_MATH_BATCH_INVERSE_HPP
+
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Replaces every element of [first, last) with its inverse, using Montgomery's trick: each chunk
+             * computes the running products of its elements, inverts the total once and walks back, so
+             * a chunk of n elements costs 3(n - 1) multiplications and a single field inversion.
+             * Zero elements are skipped and stay zero.
+             */
+            template<typename Iterator>
+            void batch_inverse(Iterator first, Iterator last,
+                               ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+                wait_for_all(parallel_run_in_chunks<void>(
+                    std::distance(first, last),
+                    [first](std::size_t begin, std::size_t end) {
+                        // products[i] is the product of all the non-zero elements of [begin, begin + i).
+                        std::vector<value_type> products(end - begin);
+                        value_type acc = value_type::one();
+                        for (std::size_t i = begin; i < end; ++i) {
+                            products[i - begin] = acc;
+                            const value_type &value = first[i];
+                            if (!value.is_zero()) {
+                                acc *= value;
+                            }
+                        }
+
+                        value_type acc_inverse = acc.inversed();
+                        for (std::size_t i = end; i > begin; --i) {
+                            value_type &value = first[i - 1];
+                            if (value.is_zero()) {
+                                continue;
+                            }
+                            // Now acc_inverse is the inverse of the product of the non-zero elements of [begin, i).
+                            value_type inverse = acc_inverse * products[i - 1 - begin];
+                            acc_inverse *= value;
+                            value = inverse;
+                        }
+                    }, pool_id));
+            }
+
+            template<typename Range>
+            void batch_inverse(Range &values, ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                batch_inverse(std::begin(values), std::end(values), pool_id);
+            }
+
+            /**
+             * Replaces the elements of [first, last) with their inclusive prefix products, i.e. the i-th element
+             * becomes first[0] * first[1] * ... * first[i]. Runs in three passes: local prefix products of every
+             * chunk in parallel, a sequential scan over the products of the chunks, and a parallel pass multiplying
+             * each chunk with the product of all the previous ones.
+             */
+            template<typename Iterator>
+            void parallel_prefix_product(Iterator first, Iterator last,
+                                         ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+                if (first == last) {
+                    return;
+                }
+
+                // Each chunk returns its range and the product of its elements.
+                std::vector<std::tuple<std::size_t, std::size_t, value_type>> chunks =
+                    wait_for_all(parallel_run_in_chunks<std::tuple<std::size_t, std::size_t, value_type>>(
+                        std::distance(first, last),
+                        [first](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin + 1; i < end; ++i) {
+                                first[i] *= first[i - 1];
+                            }
+                            return std::make_tuple(begin, end, first[end - 1]);
+                        }, pool_id));
+
+                if (chunks.size() <= 1) {
+                    return;
+                }
+
+                std::vector<value_type> offsets(chunks.size());
+                offsets[0] = value_type::one();
+                for (std::size_t k = 1; k < chunks.size(); ++k) {
+                    offsets[k] = offsets[k - 1] * std::get<2>(chunks[k - 1]);
+                }
+
+                // Chunks are few and large here, so we use the higher level to get one task per chunk.
+                parallel_for(1, chunks.size(), [first, &chunks, &offsets](std::size_t k) {
+                    for (std::size_t i = std::get<0>(chunks[k]); i < std::get<1>(chunks[k]); ++i) {
+                        first[i] *= offsets[k];
+                    }
+                }, ThreadPool::PoolLevel::HIGH);
+            }
+
+            template<typename Range>
+            void parallel_prefix_product(Range &values, ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+                parallel_prefix_product(std::begin(values), std::end(values), pool_id);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_MATH_BATCH_INVERSE_HPP
@@ -31,7 +31,7 @@
 #endif
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -46,12 +46,12 @@ namespace nil {
 
                 std::vector<std::shared_ptr<evaluation_domain<FieldType>>> domain_set(set_size);
                 
-                // make_evaluation_domain uses LOW level thread pool, so this function needs to use
+                // get_evaluation_domain uses LOW level thread pool, so this function needs to use
                 // ThreadPool::PoolLevel::HIGH.
                 parallel_for(0, set_size, [&domain_set, max_domain_degree](std::size_t i){
                     const std::size_t domain_size = std::pow(2, max_domain_degree - i);
                     std::shared_ptr<evaluation_domain<FieldType>> domain =
-                        make_evaluation_domain<FieldType>(domain_size);
+                        get_evaluation_domain<FieldType>(domain_size);
                     domain_set[i] = domain;
                 }, ThreadPool::PoolLevel::HIGH);
 
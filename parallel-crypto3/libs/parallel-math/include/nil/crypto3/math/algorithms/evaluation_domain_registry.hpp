@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
+#define PARALLEL_CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Process-wide cache of evaluation domains, keyed by the domain size.
+             *
+             * Only basic radix-2 domains are cached: they are immutable after construction, so one instance can be
+             * shared between threads and proofs. Other domain types compute their tables lazily, those are created
+             * fresh on each call, as make_evaluation_domain does.
+             *
+             * The least recently used domains are dropped from the registry once the estimated size of the cached
+             * tables exceeds the memory budget. Dropped domains stay alive for as long as someone holds a pointer to
+             * them.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class evaluation_domain_registry {
+                typedef typename FieldType::value_type field_value_type;
+
+            public:
+                typedef evaluation_domain<FieldType, ValueType> domain_type;
+                typedef std::shared_ptr<domain_type> domain_ptr;
+
+                // The registry lives as long as the process, so it is bounded by default. Enough for the domains
+                // of a proof over 2^22 rows of a 256-bit field.
+                static constexpr std::size_t DEFAULT_MEMORY_BUDGET = std::size_t(1) << 30;
+
+                static evaluation_domain_registry &instance() {
+                    static evaluation_domain_registry registry;
+                    return registry;
+                }
+
+                domain_ptr get_domain(std::size_t m) {
+                    if (!detail::is_basic_radix2_domain<FieldType>(m)) {
+                        return make_evaluation_domain<FieldType, ValueType>(m);
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        auto it = entries.find(m);
+                        if (it != entries.end() && it->second.domain) {
+                            touch(it->second);
+                            return it->second.domain;
+                        }
+                    }
+
+                    // Domain construction runs on the thread pool, so we must not hold the lock here. Two threads
+                    // may build the same domain at once, then the one which comes second just uses the first one.
+                    domain_ptr domain = make_evaluation_domain<FieldType, ValueType>(m);
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    entry_type &entry = get_entry(m);
+                    if (!entry.domain) {
+                        entry.domain = domain;
+                        // The domain keeps the powers of omega and omega^-1.
+                        entry.memory_usage += 2 * m * sizeof(field_value_type);
+                        memory_usage += 2 * m * sizeof(field_value_type);
+                        evict();
+                    }
+                    return entry.domain;
+                }
+
+                /**
+                 * Sets the limit on the estimated memory used by the cached tables, 0 means no limit.
+                 */
+                void set_memory_budget(std::size_t bytes) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    memory_budget = bytes;
+                    evict();
+                }
+
+                std::size_t get_memory_usage() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return memory_usage;
+                }
+
+                std::size_t size() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return entries.size();
+                }
+
+                void clear() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    entries.clear();
+                    lru.clear();
+                    memory_usage = 0;
+                }
+
+            private:
+                struct entry_type {
+                    domain_ptr domain;
+                    std::size_t memory_usage = 0;
+                    typename std::list<std::size_t>::iterator lru_position;
+                };
+
+                evaluation_domain_registry() = default;
+
+                evaluation_domain_registry(const evaluation_domain_registry &) = delete;
+                evaluation_domain_registry &operator=(const evaluation_domain_registry &) = delete;
+
+                // All the functions below expect the mutex to be locked.
+                void touch(entry_type &entry) {
+                    lru.splice(lru.begin(), lru, entry.lru_position);
+                }
+
+                entry_type &get_entry(std::size_t m) {
+                    auto it = entries.find(m);
+                    if (it != entries.end()) {
+                        touch(it->second);
+                        return it->second;
+                    }
+                    lru.push_front(m);
+                    entry_type &entry = entries[m];
+                    entry.lru_position = lru.begin();
+                    return entry;
+                }
+
+                // Drops the least recently used entries until we fit into the budget. The most recently used entry
+                // always stays, even if it alone is over the budget.
+                void evict() {
+                    if (memory_budget == 0) {
+                        return;
+                    }
+                    while (memory_usage > memory_budget && lru.size() > 1) {
+                        auto it = entries.find(lru.back());
+                        memory_usage -= it->second.memory_usage;
+                        entries.erase(it);
+                        lru.pop_back();
+                    }
+                }
+
+                mutable std::mutex mutex;
+                std::unordered_map<std::size_t, entry_type> entries;
+                // Domain sizes, most recently used first.
+                std::list<std::size_t> lru;
+                std::size_t memory_usage = 0;
+                std::size_t memory_budget = DEFAULT_MEMORY_BUDGET;
+            };
+
+            /**
+             * Returns an evaluation domain of size m shared through the process-wide registry.
+             * Use it instead of make_evaluation_domain for domains which are created more than once.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            std::shared_ptr<evaluation_domain<FieldType, ValueType>> get_evaluation_domain(std::size_t m) {
+                return evaluation_domain_registry<FieldType, ValueType>::instance().get_domain(m);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_MATH_EVALUATION_DOMAIN_REGISTRY_HPP
@@ -73,7 +73,7 @@ namespace nil {
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
                  */
                 template<typename FieldType, typename Range>
-                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                void basic_radix2_fft_iterative(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
                     typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
                         value_type;
                     BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
@@ -133,6 +133,192 @@ namespace nil {
                     }
                 }
 
+                // Transforms of at least this size are done with the four-step algorithm. Below it the whole
+                // array fits into L2 cache anyway, and the iterative version has less overhead.
+                static constexpr std::size_t FOUR_STEP_FFT_MIN_SIZE = 1 << 16;
+
+                // Side of the square tiles used in the transpositions, 32x32 elements of 32 bytes fit into L1.
+                // Also the number of columns whose FFTs are done together through a small buffer.
+                static constexpr std::size_t TRANSPOSE_TILE_SIZE = 32;
+
+                /*
+                 * Single-threaded in-place FFT of the n elements starting at a. The twiddles are taken from the
+                 * cache of a larger domain: omega_n^i = omega_cache[i * cache_stride].
+                 */
+                template<typename FieldType, typename ValueType>
+                void basic_radix2_fft_serial(ValueType *a, std::size_t n,
+                                             const std::vector<typename FieldType::value_type> &omega_cache,
+                                             std::size_t cache_stride) {
+                    const std::size_t logn = log2(n);
+
+                    for (std::size_t k = 0; k < n; ++k) {
+                        const std::size_t rk = bitreverse(k, logn);
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
+                    }
+
+                    ValueType t;
+                    for (std::size_t m = 1, inc = n / 2 * cache_stride; m < n; m <<= 1, inc >>= 1) {
+                        for (std::size_t k = 0; k < n; k += 2 * m) {
+                            // The first twiddle is always one.
+                            t = a[k + m];
+                            a[k + m] = a[k];
+                            a[k + m] -= t;
+                            a[k] += t;
+
+                            for (std::size_t j = 1, idx = inc; j < m; ++j, idx += inc) {
+                                t = a[k + j + m];
+                                t *= omega_cache[idx];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Transposes in place the size x size matrix with the given row stride starting at a, swapping the
+                 * elements above the diagonal tile by tile.
+                 */
+                template<typename ValueType>
+                void transpose_square_in_place(ValueType *a, std::size_t size, std::size_t stride) {
+                    const std::size_t tiles = (size + TRANSPOSE_TILE_SIZE - 1) / TRANSPOSE_TILE_SIZE;
+
+                    // Each tile row is large, use the higher level pool to avoid the minimal chunk size of the low one.
+                    parallel_for(0, tiles, [a, size, stride, tiles](std::size_t tile_row) {
+                        const std::size_t r_begin = tile_row * TRANSPOSE_TILE_SIZE;
+                        const std::size_t r_end = std::min(size, r_begin + TRANSPOSE_TILE_SIZE);
+                        for (std::size_t tile_col = tile_row; tile_col < tiles; ++tile_col) {
+                            const std::size_t c_begin = tile_col * TRANSPOSE_TILE_SIZE;
+                            const std::size_t c_end = std::min(size, c_begin + TRANSPOSE_TILE_SIZE);
+                            for (std::size_t r = r_begin; r < r_end; ++r) {
+                                for (std::size_t c = std::max(c_begin, r + 1); c < c_end; ++c) {
+                                    std::swap(a[r * stride + c], a[c * stride + r]);
+                                }
+                            }
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+                }
+
+                /*
+                 * Transposes in place the size x (2 * size) matrix at a, size being a power of two. Both square
+                 * halves are transposed in place first, then the rows of size elements are moved to their places
+                 * along the cycles of the permutation, each cycle needing a single row of buffer.
+                 *
+                 * After the first step row 2r + h holds row r of the transposed half h, and it has to go to row
+                 * h * size + r. With M = 2 * size - 1 that is row b going to b * size mod M, the rotation of the
+                 * bits of b by one to the right, so each cycle is started from its smallest row.
+                 */
+                template<typename ValueType>
+                void transpose_half_square_in_place(ValueType *a, std::size_t size) {
+                    transpose_square_in_place(a, size, 2 * size);
+                    transpose_square_in_place(a + size, size, 2 * size);
+
+                    const std::size_t modulus = 2 * size - 1, bits = log2(2 * size);
+                    auto rotate_left = [modulus, bits](std::size_t b) {
+                        return ((b << 1) | (b >> (bits - 1))) & modulus;
+                    };
+
+                    std::vector<std::size_t> cycle_starts;
+                    for (std::size_t b = 1; b < modulus; ++b) {
+                        bool smallest = true;
+                        for (std::size_t c = rotate_left(b); c != b && smallest; c = rotate_left(c)) {
+                            smallest = b < c;
+                        }
+                        if (smallest) {
+                            cycle_starts.push_back(b);
+                        }
+                    }
+
+                    parallel_for(0, cycle_starts.size(), [a, size, &cycle_starts, &rotate_left](std::size_t i) {
+                        const std::size_t start = cycle_starts[i];
+                        std::vector<ValueType> row(a + start * size, a + (start + 1) * size);
+                        // Row rotate_left(b) is the one which goes to row b.
+                        std::size_t b = start;
+                        for (std::size_t src = rotate_left(b); src != start; b = src, src = rotate_left(src)) {
+                            std::copy(a + src * size, a + (src + 1) * size, a + b * size);
+                        }
+                        std::copy(row.begin(), row.end(), a + b * size);
+                    }, ThreadPool::PoolLevel::HIGH);
+                }
+
+                /*
+                 * Four-step (Bailey) FFT. With n = n1 * n2, the input is viewed as an n2 x n1 matrix x[j2][j1], and
+                 *     X[k2 + n2 * k1] = sum_{j1} omega_{n1}^{j1 k1} * omega^{j1 k2} * sum_{j2} omega_{n2}^{j2 k2} x[j2][j1],
+                 * i.e. n1 FFTs of size n2 over the columns, a twiddle multiplication, and n2 FFTs of size n1 over the
+                 * rows. The column FFTs are done for a few columns at once, copied into a small buffer, so every
+                 * small FFT runs on contiguous memory which fits into L2, including its bit-reversal, and each of
+                 * them is a separate task without any global barrier inside. The result is transposed in place, so
+                 * apart from the column buffers no memory is allocated.
+                 * It's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_four_step(Range &a,
+                                                const std::vector<typename FieldType::value_type> &omega_cache) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (omega_cache.size() < n)
+                        throw std::invalid_argument("four-step fft expects the omega cache of size n");
+
+                    const std::size_t n1 = std::size_t(1) << (logn - logn / 2);
+                    const std::size_t n2 = n / n1;
+                    const std::size_t group = std::min(n1, TRANSPOSE_TILE_SIZE);
+                    value_type *data = &a[0];
+
+                    // FFTs of size n2 over the columns, fused with the multiplication by omega^{j1 k2}.
+                    parallel_for(0, n1 / group, [data, &omega_cache, n1, n2, group](std::size_t g) {
+                        std::vector<value_type> columns(group * n2);
+                        for (std::size_t j2 = 0; j2 < n2; ++j2) {
+                            for (std::size_t c = 0; c < group; ++c) {
+                                columns[c * n2 + j2] = data[j2 * n1 + g * group + c];
+                            }
+                        }
+                        for (std::size_t c = 0; c < group; ++c) {
+                            const std::size_t j1 = g * group + c;
+                            value_type *column = columns.data() + c * n2;
+                            basic_radix2_fft_serial<FieldType>(column, n2, omega_cache, n1);
+                            for (std::size_t k2 = 1, idx = j1; k2 < n2; ++k2, idx += j1) {
+                                column[k2] *= omega_cache[idx];
+                            }
+                        }
+                        for (std::size_t k2 = 0; k2 < n2; ++k2) {
+                            for (std::size_t c = 0; c < group; ++c) {
+                                data[k2 * n1 + g * group + c] = columns[c * n2 + k2];
+                            }
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+
+                    // FFTs of size n1 over the rows.
+                    parallel_for(0, n2, [data, &omega_cache, n1, n2](std::size_t k2) {
+                        basic_radix2_fft_serial<FieldType>(data + k2 * n1, n1, omega_cache, n2);
+                    }, ThreadPool::PoolLevel::HIGH);
+
+                    // Now a[k2][k1] = X[k2 + n2 * k1], the transposition brings it to the natural order.
+                    if (n1 == n2) {
+                        transpose_square_in_place(data, n1, n1);
+                    } else {
+                        transpose_half_square_in_place(data, n2);
+                    }
+                }
+
+                /**
+                 * Picks the four-step algorithm for large transforms, the iterative one otherwise.
+                 * It's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                    if (a.size() >= FOUR_STEP_FFT_MIN_SIZE && omega_cache.size() >= a.size()) {
+                        basic_radix2_fft_four_step<FieldType>(a, omega_cache);
+                    } else {
+                        basic_radix2_fft_iterative<FieldType>(a, omega_cache);
+                    }
+                }
+
                 /**
                  * Note that it's the caller's responsibility to multiply by 1/N.
                  */
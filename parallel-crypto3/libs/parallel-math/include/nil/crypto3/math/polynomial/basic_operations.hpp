@@ -311,6 +311,64 @@ namespace nil {
                 return result;
             }
 
+            /**
+             * Divides polynomial A by the linear factor (X - z) with synthetic division (Horner's scheme).
+             * This is a single sequential pass over the coefficients, there is no point in splitting it into tasks.
+             * Q may be the same object as A, then the division is done in-place.
+             * Output: Polynomial Q, such that A = Q * (X - z) + A(z). Returns the remainder A(z).
+             */
+            template<typename Range, typename FieldValueType>
+            FieldValueType divide_by_linear_factor(Range &q, const Range &a, const FieldValueType &z) {
+                std::size_t n = std::distance(std::begin(a), std::end(a));
+                if (n <= 1) {
+                    FieldValueType remainder = (n == 0) ? FieldValueType::zero() : a[0];
+                    q = Range(1, FieldValueType::zero());
+                    return remainder;
+                }
+
+                q.resize(n);
+                FieldValueType carry = a[n - 1];
+                for (std::size_t i = n - 1; i > 0; --i) {
+                    // Read a[i - 1] before writing q[i - 1], they are the same element for in-place division.
+                    FieldValueType next = a[i - 1] + z * carry;
+                    q[i - 1] = carry;
+                    carry = next;
+                }
+                q.resize(n - 1);
+                condense(q);
+                return carry;
+            }
+
+            /**
+             * Divides polynomial A by each of the linear factors (X - z_i) in a single pass over the coefficients
+             * of A. The chains for different points are independent and interleaved in the inner loop.
+             * Output: Polynomials Q_i, such that A = Q_i * (X - z_i) + A(z_i). Returns the remainders A(z_i).
+             */
+            template<typename Range, typename FieldValueType>
+            std::vector<FieldValueType> divide_by_linear_factors(
+                    std::vector<Range> &q, const Range &a, const std::vector<FieldValueType> &points) {
+                std::size_t n = std::distance(std::begin(a), std::end(a));
+                std::size_t k = points.size();
+                if (n <= 1) {
+                    q.assign(k, Range(1, FieldValueType::zero()));
+                    return std::vector<FieldValueType>(k, (n == 0) ? FieldValueType::zero() : a[0]);
+                }
+
+                q.assign(k, Range(n - 1, FieldValueType::zero()));
+                std::vector<FieldValueType> carries(k, a[n - 1]);
+                for (std::size_t i = n - 1; i > 0; --i) {
+                    const FieldValueType &coeff = a[i - 1];
+                    for (std::size_t p = 0; p < k; ++p) {
+                        q[p][i - 1] = carries[p];
+                        carries[p] = coeff + points[p] * carries[p];
+                    }
+                }
+                for (auto &q_p : q) {
+                    condense(q_p);
+                }
+                return carries;
+            }
+
             /**
              * Perform the standard Euclidean Division algorithm. We can not assume that q or r are empty.
              * Input: Polynomial A, Polynomial B, where A / B
@@ -332,6 +390,16 @@ namespace nil {
                     // We will always have no reminder here.
                     r.resize(1);
                     r[0] = 0u;
+                }
+                    // Special case when B is linear, B = b_1 * (X - z).
+                else if (d == 1) {
+                    value_type c = b[1].inversed();
+                    value_type remainder = divide_by_linear_factor(q, a, -b[0] * c);
+                    if (c != value_type::one()) {
+                        nil::crypto3::parallel_foreach(std::begin(q), std::end(q), [&c](value_type& value) {value *= c;});
+                    }
+                    r.resize(1);
+                    r[0] = remainder;
                 }
                     // Special case when B = X^N + C.
                 else if (b.back() == value_type::one() && is_zero(b.begin() + 1, b.end() - 1) && a.size() >= b.size()) {
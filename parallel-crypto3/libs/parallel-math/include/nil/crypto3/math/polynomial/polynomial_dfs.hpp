@@ -39,7 +39,7 @@
 #include <iterator>
 #include <unordered_map>
 
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -144,7 +144,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -354,14 +354,14 @@ namespace nil {
                     } else {
                         typedef typename value_type::field_type FieldType;
                         if (old_domain == nullptr) {
-                            old_domain = make_evaluation_domain<FieldType>(this->size());
+                            old_domain = get_evaluation_domain<FieldType>(this->size());
                         } else {
                             BOOST_ASSERT_MSG(old_domain->size() == this->size(), "Old domain size is not equal to the polynomial size");
                         }
                         old_domain->inverse_fft(this->val);
                         this->val.resize(_sz, FieldValueType::zero());
                         if (new_domain == nullptr) {
-                            new_domain = make_evaluation_domain<FieldType>(_sz);
+                            new_domain = get_evaluation_domain<FieldType>(_sz);
                         } else {
                             BOOST_ASSERT_MSG(new_domain->size() == _sz, "New domain size is not equal to the polynomial size");
                         }
@@ -889,10 +889,10 @@ namespace nil {
                     domain_cache[i] = nullptr;
                 }
 
-                // We cannot use LOW level thread pool here, make_evaluation_domain uses it.
+                // We cannot use LOW level thread pool here, get_evaluation_domain uses it.
                 parallel_foreach(needed_domain_sizes.begin(), needed_domain_sizes.end(),
                     [&domain_cache](std::size_t domain_size) {
-                        domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                        domain_cache[domain_size] = get_evaluation_domain<FieldType>(domain_size);
                     }, ThreadPool::PoolLevel::HIGH);
 
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
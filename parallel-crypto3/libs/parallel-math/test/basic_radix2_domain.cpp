@@ -149,4 +149,24 @@ BOOST_AUTO_TEST_CASE(fft_vs_multiplication_benchmark) {
              << " ms" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(four_step_fft_test) {
+    using value_type = FieldType::value_type;
+    // Both shapes of the four-step split: square for even log, n1 = 2 * n2 for odd log.
+    for (std::size_t log_size : {1, 4, 7, 16, 17}) {
+        const std::size_t size = 1 << log_size;
+        std::vector<value_type> cache;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), cache);
+
+        std::vector<value_type> a(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            a[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> b = a;
+
+        nil::crypto3::math::detail::basic_radix2_fft_iterative<FieldType>(a, cache);
+        nil::crypto3::math::detail::basic_radix2_fft_four_step<FieldType>(b, cache);
+        BOOST_CHECK(a == b);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
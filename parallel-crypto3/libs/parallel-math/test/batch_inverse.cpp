@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE batch_inverse_test
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+
+BOOST_AUTO_TEST_SUITE(batch_inverse_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_inverse_test) {
+    // Large enough to be split into several chunks.
+    for (std::size_t size : {0, 1, 7, 20000}) {
+        std::vector<typename FieldType::value_type> values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values[i] = (i % 5 == 3) ? FieldType::value_type::zero() : random_element<FieldType>();
+        }
+        std::vector<typename FieldType::value_type> inverses = values;
+        batch_inverse(inverses);
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if (values[i].is_zero()) {
+                BOOST_CHECK(inverses[i].is_zero());
+            } else {
+                BOOST_CHECK_EQUAL(inverses[i], values[i].inversed());
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_prefix_product_test) {
+    for (std::size_t size : {0, 1, 7, 20000}) {
+        std::vector<typename FieldType::value_type> values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values[i] = random_element<FieldType>();
+        }
+        std::vector<typename FieldType::value_type> products = values;
+        parallel_prefix_product(products);
+
+        typename FieldType::value_type expected = FieldType::value_type::one();
+        for (std::size_t i = 0; i < size; ++i) {
+            expected *= values[i];
+            BOOST_CHECK_EQUAL(products[i], expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fft_benchmark_test
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+
+using namespace nil::crypto3::math;
+
+struct F {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+    using value_type = typename FieldType::value_type;
+    const std::size_t SEED = 1337;
+    F() : alg_rnd_engine(SEED) {}
+
+    // Random input of the given size and the omega cache for it.
+    std::pair<std::vector<value_type>, std::vector<value_type>> generate_input(std::size_t size) {
+        std::vector<value_type> values(size);
+        for (auto &value : values) {
+            value = alg_rnd_engine();
+        }
+        std::vector<value_type> omega_cache;
+        detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+        return {std::move(values), std::move(omega_cache)};
+    }
+
+    nil::crypto3::random::algebraic_engine<FieldType> alg_rnd_engine;
+};
+
+BOOST_FIXTURE_TEST_SUITE(fft_benchmark_test_suite, F)
+
+#define FFT_BENCHMARK_TEST_CASE(log_size, num_iterations)                                   \
+    BENCHMARK_AUTO_TEST_CASE(fft_##log_size##_test, num_iterations) {                      \
+        auto [values, omega_cache] = generate_input(1ul << log_size);                      \
+        auto values_copy = values;                                                         \
+                                                                                           \
+        START_TIMER("iterative fft 2^" #log_size)                                          \
+        detail::basic_radix2_fft_iterative<FieldType>(values, omega_cache);                \
+        STOP_TIMER("iterative fft 2^" #log_size)                                           \
+                                                                                           \
+        START_TIMER("four-step fft 2^" #log_size)                                          \
+        detail::basic_radix2_fft_four_step<FieldType>(values_copy, omega_cache);           \
+        STOP_TIMER("four-step fft 2^" #log_size)                                           \
+                                                                                           \
+        BOOST_CHECK(values == values_copy);                                                \
+    }
+
+FFT_BENCHMARK_TEST_CASE(16, 20)
+FFT_BENCHMARK_TEST_CASE(18, 20)
+FFT_BENCHMARK_TEST_CASE(20, 10)
+FFT_BENCHMARK_TEST_CASE(22, 5)
+FFT_BENCHMARK_TEST_CASE(24, 3)
+
+BOOST_AUTO_TEST_SUITE_END()
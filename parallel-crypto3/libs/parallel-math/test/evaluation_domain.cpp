@@ -58,6 +58,7 @@
 #include <nil/crypto3/math/domains/step_radix2_domain.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 
 #include <nil/crypto3/math/polynomial/evaluate.hpp>
 
@@ -538,4 +539,40 @@ BOOST_AUTO_TEST_CASE(get_vanishing_polynomial) {
                             arithmetic_sequence_domain<field_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(evaluation_domain_registry_test) {
+    typedef fields::bls12_fr<381> field_type;
+    typedef typename field_type::value_type value_type;
+    typedef evaluation_domain_registry<field_type> registry_type;
+
+    registry_type &registry = registry_type::instance();
+    registry.clear();
+
+    // Radix-2 domains are shared, and behave like the fresh ones.
+    auto domain = get_evaluation_domain<field_type>(16);
+    BOOST_CHECK(domain == get_evaluation_domain<field_type>(16));
+    BOOST_CHECK_EQUAL(registry.size(), 1);
+
+    std::vector<value_type> a(16), b;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = nil::crypto3::algebra::random_element<field_type>();
+    }
+    b = a;
+    domain->fft(a);
+    make_evaluation_domain<field_type>(16)->fft(b);
+    BOOST_CHECK(a == b);
+
+    // The budget drops the least recently used sizes, the domains handed out stay valid.
+    get_evaluation_domain<field_type>(32);
+    get_evaluation_domain<field_type>(64);
+    BOOST_CHECK_EQUAL(registry.size(), 3);
+    registry.set_memory_budget(1);
+    BOOST_CHECK_EQUAL(registry.size(), 1);
+    BOOST_CHECK(domain != get_evaluation_domain<field_type>(16));
+    domain->fft(b);
+
+    registry.set_memory_budget(registry_type::DEFAULT_MEMORY_BUDGET);
+    registry.clear();
+    BOOST_CHECK_EQUAL(registry.get_memory_usage(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
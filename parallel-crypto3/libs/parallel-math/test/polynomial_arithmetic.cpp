@@ -351,6 +351,64 @@ BOOST_AUTO_TEST_CASE(polynomial_division2) {
     BOOST_CHECK(R_ans == R);
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_division_by_linear_factor) {
+
+    typedef typename FieldType::value_type value_type;
+
+    // a = (X - 2)(X^2 + 3X + 5) + 7
+    std::vector<value_type> a = {-value_type(3u), -value_type(1u), 1u, 1u};
+
+    std::vector<value_type> Q;
+    value_type remainder = nil::crypto3::math::divide_by_linear_factor(Q, a, value_type(2u));
+
+    std::vector<value_type> Q_ans = {5u, 3u, 1u};
+    BOOST_CHECK(Q_ans == Q);
+    BOOST_CHECK(remainder == value_type(7u));
+
+    // In-place division.
+    remainder = nil::crypto3::math::divide_by_linear_factor(a, a, value_type(2u));
+    BOOST_CHECK(Q_ans == a);
+    BOOST_CHECK(remainder == value_type(7u));
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_division_by_linear_factors) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> a = {-value_type(3u), -value_type(1u), 1u, 1u};
+    std::vector<value_type> points = {2u, 1u};
+
+    std::vector<std::vector<value_type>> Q;
+    std::vector<value_type> remainders = nil::crypto3::math::divide_by_linear_factors(Q, a, points);
+
+    BOOST_CHECK_EQUAL(Q.size(), 2);
+    BOOST_CHECK(Q[0] == std::vector<value_type>({5u, 3u, 1u}));
+    BOOST_CHECK(Q[1] == std::vector<value_type>({1u, 2u, 1u}));
+    BOOST_CHECK(remainders[0] == value_type(7u));
+    BOOST_CHECK(remainders[1] == -value_type(2u));
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_division_non_monic_linear) {
+
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> a = {-value_type(3u), -value_type(1u), 1u, 1u};
+    // b = 2 * (X - 2)
+    std::vector<value_type> b = {-value_type(4u), 2u};
+
+    std::vector<value_type> Q;
+    std::vector<value_type> R;
+
+    nil::crypto3::math::division(Q, R, a, b);
+
+    std::vector<value_type> Q_ans = {5u, 3u, 1u};
+    BOOST_CHECK_EQUAL(Q.size(), Q_ans.size());
+    for (std::size_t i = 0; i < Q.size(); i++) {
+        BOOST_CHECK(Q[i] * value_type(2u) == Q_ans[i]);
+    }
+    BOOST_CHECK(R == std::vector<value_type>({7u}));
+}
+
 BOOST_AUTO_TEST_CASE(extended_gcd) {
 
     std::vector<typename ScalarFieldType::value_type> a = {0u, 0u, 0u, 0u, 1u};
@@ -37,6 +37,8 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <map>
@@ -46,8 +48,9 @@
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
@@ -404,6 +407,36 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                // Passes the values of f on the coset of x_index to the consumer, in the order the leaf stores them.
+                template<typename FRI, typename ElementConsumer, typename PolynomialDFS>
+                static inline void consume_coset_values(ElementConsumer &element_consumer, const PolynomialDFS &f,
+                                                        std::size_t x_index, std::size_t domain_size,
+                                                        std::size_t coset_size) {
+                    std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+                    s_indices[0][0] = x_index;
+                    s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                    element_consumer.consume(f[s_indices[0][0]]);
+                    element_consumer.consume(f[s_indices[0][1]]);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < coset_size / FRI::m) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                            s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+
+                            element_consumer.consume(f[s_indices[i][0]]);
+                            element_consumer.consume(f[s_indices[i][1]]);
+
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                }
+
                 template<typename FRI,
                     typename std::enable_if<
                         std::is_base_of<
@@ -426,40 +459,16 @@ namespace nil {
                     std::size_t domain_size = D->size();
                     std::size_t coset_size = 1 << fri_step;
                     std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
+
+                    return containers::make_merkle_tree_from_leaf_generator<typename FRI::merkle_tree_hash_type, FRI::m>(
                         leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size)
-                    );
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
+                        [&f, domain_size, coset_size](std::size_t begin, std::size_t end, const auto &consume) {
+                            detail::fri_field_element_consumer<FRI> leaf(coset_size);
+                            for (std::size_t x_index = begin; x_index < end; x_index++) {
+                                consume_coset_values<FRI>(leaf.reset_cursor(), f, x_index, domain_size, coset_size);
+                                consume(leaf);
                             }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                        });
                 }
 
                 template<typename FRI,
@@ -517,41 +526,21 @@ namespace nil {
                     std::size_t list_size = poly.size();
                     std::size_t coset_size = 1 << fri_step;
                     std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
+
+                    // Leaves are serialized right before hashing into one buffer per subtree, so the serialized
+                    // batch never exists in memory as a whole.
+                    return containers::make_merkle_tree_from_leaf_generator<typename FRI::merkle_tree_hash_type, FRI::m>(
                         leafs_number,
-                        detail::fri_field_element_consumer<FRI>(coset_size * list_size)
-                    );
-
-                    parallel_for(0, leafs_number, [&y_data, &poly, domain_size, coset_size, list_size](std::size_t x_index) {
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
+                        [&poly, domain_size, coset_size, list_size](std::size_t begin, std::size_t end, const auto &consume) {
+                            detail::fri_field_element_consumer<FRI> leaf(coset_size * list_size);
+                            for (std::size_t x_index = begin; x_index < end; x_index++) {
+                                auto& element_consumer = leaf.reset_cursor();
+                                for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                    consume_coset_values<FRI>(element_consumer, poly[polynom_index], x_index, domain_size, coset_size);
                                 }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
+                                consume(leaf);
                             }
-                        }
-                    });
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                        });
                 }
 
                 template<typename FRI, typename ContainerType,
@@ -600,6 +589,37 @@ namespace nil {
                     return x_index;
                 }
 
+                /*
+                 * Index of the query point challenge^((p - 1) / |D_0|) in D[0]. The point lies in the subgroup of order
+                 * |D_0| = 2^k, so its discrete logarithm base omega is found bit by bit from the lowest one: once the
+                 * known lower bits are divided out, raising the point to 2^(k - 1 - bit) gives -1 iff the bit is set.
+                 * Returns |D_0| if the point is not in D[0], which only happens for a zero challenge.
+                 */
+                template<typename FRI>
+                static std::uint64_t get_query_index(const typename FRI::field_type::value_type &challenge,
+                                                     const typename FRI::params_type &fri_params) {
+                    typedef typename FRI::field_type::value_type value_type;
+
+                    const std::size_t domain_size = fri_params.D[0]->size();
+                    const std::size_t log_domain_size = static_cast<std::size_t>(std::log2(domain_size));
+                    value_type x = challenge.pow((FRI::field_type::modulus - 1) / domain_size);
+                    value_type omega_power_inverse = fri_params.D[0]->get_domain_element(1).inversed();
+
+                    std::uint64_t x_index = 0;
+                    for (std::size_t bit = 0; bit < log_domain_size; bit++) {
+                        value_type x_power = x;
+                        for (std::size_t i = bit + 1; i < log_domain_size; i++) {
+                            x_power = x_power.squared();
+                        }
+                        if (x_power != value_type::one()) {
+                            x_index |= std::uint64_t(1) << bit;
+                            x *= omega_power_inverse;
+                        }
+                        omega_power_inverse = omega_power_inverse.squared();
+                    }
+                    return x == value_type::one() ? x_index : domain_size;
+                }
+
                 template<typename FRI>
                 static inline bool check_step_list(const typename FRI::params_type &fri_params) {
                     if (fri_params.step_list.empty()) {
@@ -820,7 +840,7 @@ namespace nil {
 
                         parallel_for(0, required_domains.size(),
                             [&required_domains, &d_cache](std::size_t i) {
-                            d_cache[required_domains[i]] = math::make_evaluation_domain<typename FRI::field_type>(required_domains[i]);
+                            d_cache[required_domains[i]] = math::get_evaluation_domain<typename FRI::field_type>(required_domains[i]);
                         }, ThreadPool::PoolLevel::HIGH);
 
                         parallel_for(0, key_index_pairs.size(),
@@ -1006,15 +1026,8 @@ namespace nil {
                     typename FRI::round_proofs_batch_type proof;
 
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
-
-                        std::uint64_t x_index = 0;
-
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(challenges[query_id], fri_params);
+                        BOOST_ASSERT(x_index < fri_params.D[0]->size());
 
                         // Fill round proofs
                         std::vector<typename FRI::round_proof_type> round_proofs =
@@ -1046,15 +1059,8 @@ namespace nil {
                     parallel_for(0, fri_params.lambda,
                         [&proof, &fri_params, &precommitments, &g_coeffs, &g, &challenges](std::size_t query_id) {
 
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
-
-                        std::uint64_t x_index = 0;
-
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(challenges[query_id], fri_params);
+                        BOOST_ASSERT(x_index < fri_params.D[0]->size());
 
                         std::map<std::size_t, typename FRI::initial_proof_type>
                             initial_proof = build_initial_proof<FRI, PolynomialType>(
@@ -1186,6 +1192,213 @@ namespace nil {
                     return proof;
                 }
 
+                /*
+                 * Checks the query_id-th query of the proof. denominator_inverses holds the inverses of the
+                 * denominators at the points of the query, two per pair of points, grouped by polynomial batch.
+                 */
+                template<typename FRI>
+                static bool verify_query(
+                    const typename FRI::proof_type                                                      &proof,
+                    std::size_t                                                                         query_id,
+                    std::uint64_t                                                                       x_index,
+                    const typename FRI::params_type                                                     &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type>                          &commitments,
+                    const typename FRI::field_type::value_type                                          theta,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>>                &poly_ids,
+                    const std::vector<typename FRI::field_type::value_type>                             &combined_U,
+                    const typename FRI::field_type::value_type                                          *denominator_inverses,
+                    const std::vector<typename FRI::field_type::value_type>                             &alphas
+                ) {
+                    const typename FRI::query_proof_type &query_proof = proof.query_proofs[query_id];
+
+                    std::size_t domain_size = fri_params.D[0]->size();
+                    std::size_t coset_size = 1 << fri_params.step_list[0];
+                    typename FRI::field_type::value_type x;
+
+                    std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
+                    std::vector<std::array<std::size_t, FRI::m>> s_indices;
+                    std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]);
+                    auto correct_order_idx = get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[0],
+                                                                    s_indices);
+
+                    // Check initial proof. The trees of all the batches have the same number of leaves, so
+                    // their paths are hashed together.
+                    std::vector<std::reference_wrapper<const typename FRI::merkle_proof_type>> initial_paths;
+                    std::vector<detail::fri_field_element_consumer<FRI>> initial_leaves;
+                    for( auto const &it: query_proof.initial_proof ){
+                        auto k = it.first;
+                        if (query_proof.initial_proof.at(k).p.root() != commitments.at(k) ) {
+                            return false;
+                        }
+
+                        detail::fri_field_element_consumer<FRI> leaf_data(
+                            coset_size * query_proof.initial_proof.at(k).values.size());
+
+                        for (std::size_t i = 0; i < query_proof.initial_proof.at(k).values.size(); i++) {
+                            for (auto [idx, pair_idx] : correct_order_idx) {
+                                leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][0]);
+                                leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][1]);
+                            }
+                        }
+                        initial_paths.emplace_back(query_proof.initial_proof.at(k).p);
+                        initial_leaves.emplace_back(std::move(leaf_data));
+                    }
+                    if (!FRI::merkle_proof_type::validate_many(initial_paths, initial_leaves)) {
+                        BOOST_LOG_TRIVIAL(info) << "Wrong initial proof";
+                        return false;
+                    }
+
+                    // Calculate combinedQ values
+                    typename FRI::field_type::value_type theta_acc = FRI::field_type::value_type::one();
+                    typename FRI::polynomial_values_type y;
+                    typename FRI::polynomial_values_type combined_eval_values;
+                    y.resize(coset_size / FRI::m);
+                    combined_eval_values.resize(coset_size / FRI::m);
+                    for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                        y[j][0] = FRI::field_type::value_type::zero();
+                        y[j][1] = FRI::field_type::value_type::zero();
+                    }
+                    for( std::size_t p = 0; p < poly_ids.size(); p++){
+                        typename FRI::polynomial_values_type Q;
+                        Q.resize(coset_size / FRI::m);
+                        for( auto const &poly_id: poly_ids[p] ){
+                            for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                                Q[j][0] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][0] * theta_acc;
+                                Q[j][1] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][1] * theta_acc;
+                            }
+                            theta_acc *= theta;
+                        }
+                        for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                            Q[j][0] -= combined_U[p];
+                            Q[j][1] -= combined_U[p];
+                            Q[j][0] *= denominator_inverses[(p * coset_size / FRI::m + j) * FRI::m];
+                            Q[j][1] *= denominator_inverses[(p * coset_size / FRI::m + j) * FRI::m + 1];
+                            y[j][0] += Q[j][0];
+                            y[j][1] += Q[j][1];
+                        }
+                    }
+                    // Check round proofs
+                    std::size_t t = 0;
+                    typename FRI::polynomial_values_type y_next;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        coset_size = 1 << fri_params.step_list[i];
+                        if (query_proof.round_proofs[i].p.root() != proof.fri_roots[i])
+                            return false;
+
+                        std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[i],
+                                                                  fri_params.D[t]);
+                        detail::fri_field_element_consumer<FRI> leaf_data(coset_size);
+                        auto correct_order_idx =
+                                get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[i], s_indices);
+                        for (auto [idx, pair_idx]: correct_order_idx) {
+                            leaf_data.consume(y[idx][0]);
+                            leaf_data.consume(y[idx][1]);
+                        }
+                        if (!query_proof.round_proofs[i].p.validate(leaf_data)) {
+                            BOOST_LOG_TRIVIAL(info) << "Wrong round merkle proof on " << i << "-th round";
+                            return false;
+                        }
+
+                        // colinear check
+                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i] - 1; step_i++, t++) {
+                            y_next.resize(y.size() / FRI::m);
+
+                            domain_size = fri_params.D[t]->size();
+                            x_index %= domain_size;
+                            x = fri_params.D[t]->get_domain_element(x_index);
+
+                            auto [s_next, s_indices_next] = calculate_s<FRI>(
+                                x_index % fri_params.D[t+1]->size(),
+                                fri_params.step_list[i], fri_params.D[t+1]
+                            );
+
+                            std::tie(s, s_indices) = calculate_s<FRI>(
+                                x_index, fri_params.step_list[i], fri_params.D[t]);
+
+                            std::size_t new_domain_size = domain_size;
+                            for (std::size_t y_ind = 0; y_ind < y_next.size(); y_ind++) {
+                                std::size_t ind0 = s_indices[2 * y_ind][0] < s_indices[2 * y_ind][1] ? 0 : 1;
+                                auto s_ch = s[2*y_ind][ind0];
+
+                                std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_l{
+                                    std::make_pair(s_ch, y[2 * y_ind][0]),
+                                    std::make_pair(-s_ch, y[2 * y_ind][1]),
+                                };
+                                math::polynomial<typename FRI::field_type::value_type> interpolant_l =
+                                        math::lagrange_interpolation(interpolation_points_l);
+
+                                ind0 = s_indices[2 * y_ind + 1][0] < s_indices[2 * y_ind + 1][1] ? 0 : 1;
+                                s_ch = s[2*y_ind + 1][ind0];
+                                std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_r{
+                                    std::make_pair(s_ch, y[2 * y_ind + 1][0]),
+                                    std::make_pair(-s_ch, y[2 * y_ind + 1][1]),
+                                };
+                                math::polynomial<typename FRI::field_type::value_type> interpolant_r =
+                                        math::lagrange_interpolation(interpolation_points_r);
+
+                                new_domain_size /= FRI::m;
+
+                                std::size_t interpolant_index_l = s_indices_next[y_ind][0];
+                                std::size_t interpolant_index_r = s_indices_next[y_ind][1];
+
+                                if( interpolant_index_l < interpolant_index_r){
+                                    y_next[y_ind][0] = interpolant_l.evaluate(alphas[t]);
+                                    y_next[y_ind][1] = interpolant_r.evaluate(alphas[t]);
+                                } else {
+                                    y_next[y_ind][0] = interpolant_r.evaluate(alphas[t]);
+                                    y_next[y_ind][1] = interpolant_l.evaluate(alphas[t]);
+                                }
+                            }
+                            x = x * x;
+                            y = y_next;
+                        }
+                        domain_size = fri_params.D[t]->size();
+                        x_index %= domain_size;
+                        x = fri_params.D[t]->get_domain_element(x_index);
+                        std::tie(s, s_indices) = calculate_s<FRI>(
+                            x_index, fri_params.step_list[i],
+                            fri_params.D[t]);
+
+                        std::size_t ind0 = s_indices[0][0] < s_indices[0][1] ? 0 : 1;
+                        auto s_ch = s[0][ind0];
+                        std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points{
+                            std::make_pair(s_ch, y[0][0]),
+                            std::make_pair(-s_ch, y[0][1]),
+                        };
+                        math::polynomial<typename FRI::field_type::value_type> interpolant_poly =
+                                math::lagrange_interpolation(interpolation_points);
+                        auto interpolant = interpolant_poly.evaluate(alphas[t]);
+
+                        std::size_t ind = s_indices[0][ind0] % (fri_params.D[t]->size()/2) < fri_params.D[t]->size() / 4 ? 0 : 1;
+                        if (interpolant != query_proof.round_proofs[i].y[0][ind]) {
+                            return false;
+                        }
+
+                        // For the last round we check final polynomial nor colinear_check
+                        y = query_proof.round_proofs[i].y;
+                        if (i < fri_params.step_list.size() - 1) {
+                            t++;
+                            domain_size = fri_params.D[t]->size();
+                            x_index %= domain_size;
+                            x = fri_params.D[t]->get_domain_element(x_index);
+                        }
+                    }
+
+                    // Final polynomial check
+                    x_index %= fri_params.D[t]->size();
+                    x = fri_params.D[t]->get_domain_element(x_index);
+                    x = x * x;
+                    std::size_t ind = x_index % (fri_params.D[t]->size() / 2) < fri_params.D[t]->size() / 4 ? 0 : 1;
+                    if (y[0][ind] != proof.final_polynomial.evaluate(x)) {
+                        return false;
+                    }
+                    if (y[0][1-ind] != proof.final_polynomial.evaluate(-x)) {
+                        return false;
+                    }
+
+                    return true;
+                }
+
                 template<typename FRI>
                 static bool verify_eval(
                     const typename FRI::proof_type                                                      &proof,
@@ -1222,200 +1435,47 @@ namespace nil {
                             transcript, proof.proof_of_work, fri_params.grinding_parameter)){
                         return false;
                     }
+                    const std::size_t domain_size = fri_params.D[0]->size();
+                    std::vector<std::uint64_t> x_indices(fri_params.lambda);
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        const typename FRI::query_proof_type &query_proof = proof.query_proofs[query_id];
-
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        std::size_t coset_size = 1 << fri_params.step_list[0];
-                        typename FRI::field_type::value_type x_challenge = transcript.template challenge<typename FRI::field_type>();
-                        typename FRI::field_type::value_type x = x_challenge.pow((FRI::field_type::modulus - 1)/domain_size);
-                        std::uint64_t x_index = 0;
-                        for( x_index = 0; x_index < domain_size; x_index++ ){
-                            if( fri_params.D[0]->get_domain_element(x_index) == x ){
-                                break;
-                            }
-                        }
-
-                        std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices;
-                        std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]);
-                        auto correct_order_idx = get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[0],
-                                                                        s_indices);
-
-                        // Check initial proof.
-                        for( auto const &it: query_proof.initial_proof ){
-                            auto k = it.first;
-                            if (query_proof.initial_proof.at(k).p.root() != commitments.at(k) ) {
-                                return false;
-                            }
-
-                            detail::fri_field_element_consumer<FRI> leaf_data(
-                                coset_size * query_proof.initial_proof.at(k).values.size());
-
-                            for (std::size_t i = 0; i < query_proof.initial_proof.at(k).values.size(); i++) {
-                                for (auto [idx, pair_idx] : correct_order_idx) {
-                                    leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][0]);
-                                    leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][1]);
-                                }
-                            }
-                            if (!query_proof.initial_proof.at(k).p.validate(leaf_data)) {
-                                BOOST_LOG_TRIVIAL(info) << "Wrong initial proof";
-                                return false;
-                            }
-                        }
-
-                        // Calculate combinedQ values
-                        typename FRI::field_type::value_type theta_acc = FRI::field_type::value_type::one();
-                        typename FRI::polynomial_values_type y;
-                        typename FRI::polynomial_values_type combined_eval_values;
-                        y.resize(coset_size / FRI::m);
-                        combined_eval_values.resize(coset_size / FRI::m);
-                        for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                            y[j][0] = FRI::field_type::value_type::zero();
-                            y[j][1] = FRI::field_type::value_type::zero();
-                        }
-                        for( std::size_t p = 0; p < poly_ids.size(); p++){
-                            typename FRI::polynomial_values_type Q;
-                            Q.resize(coset_size / FRI::m);
-                            for( auto const &poly_id: poly_ids[p] ){
-                                for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                                    Q[j][0] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][0] * theta_acc;
-                                    Q[j][1] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][1] * theta_acc;
-                                }
-                                theta_acc *= theta;
-                            }
-                            for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                                std::size_t id0 = s_indices[j][0] < s_indices[j][1] ? 0 : 1;
-                                std::size_t id1 = s_indices[j][0] < s_indices[j][1] ? 1 : 0;
-                                Q[j][0] -= combined_U[p];
-                                Q[j][1] -= combined_U[p];
-                                Q[j][0] *= denominators[p].evaluate(s[j][id0]).inversed();
-                                Q[j][1] *= denominators[p].evaluate(s[j][id1]).inversed();
-                                y[j][0] += Q[j][0];
-                                y[j][1] += Q[j][1];
-                            }
+                        x_indices[query_id] = get_query_index<FRI>(
+                            transcript.template challenge<typename FRI::field_type>(), fri_params);
+                        if (x_indices[query_id] >= domain_size) {
+                            return false;
                         }
-                        // Check round proofs
-                        std::size_t t = 0;
-                        typename FRI::polynomial_values_type y_next;
-                        for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
-                            coset_size = 1 << fri_params.step_list[i];
-                            if (query_proof.round_proofs[i].p.root() != proof.fri_roots[i])
-                                return false;
-
-                            std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[i],
-                                                                      fri_params.D[t]);
-                            detail::fri_field_element_consumer<FRI> leaf_data(coset_size);
-                            auto correct_order_idx =
-                                    get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[i], s_indices);
-                            for (auto [idx, pair_idx]: correct_order_idx) {
-                                leaf_data.consume(y[idx][0]);
-                                leaf_data.consume(y[idx][1]);
-                            }
-                            if (!query_proof.round_proofs[i].p.validate(leaf_data)) {
-                                BOOST_LOG_TRIVIAL(info) << "Wrong round merkle proof on " << i << "-th round";
-                                return false;
-                            }
+                    }
 
-                            // colinear check
-                            for (std::size_t step_i = 0; step_i < fri_params.step_list[i] - 1; step_i++, t++) {
-                                y_next.resize(y.size() / FRI::m);
-
-                                domain_size = fri_params.D[t]->size();
-                                x_index %= domain_size;
-                                x = fri_params.D[t]->get_domain_element(x_index);
-
-                                auto [s_next, s_indices_next] = calculate_s<FRI>(
-                                    x_index % fri_params.D[t+1]->size(),
-                                    fri_params.step_list[i], fri_params.D[t+1]
-                                );
-
-                                std::tie(s, s_indices) = calculate_s<FRI>(
-                                    x_index, fri_params.step_list[i], fri_params.D[t]);
-
-                                std::size_t new_domain_size = domain_size;
-                                for (std::size_t y_ind = 0; y_ind < y_next.size(); y_ind++) {
-                                    std::size_t ind0 = s_indices[2 * y_ind][0] < s_indices[2 * y_ind][1] ? 0 : 1;
-                                    auto s_ch = s[2*y_ind][ind0];
-
-                                    std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_l{
-                                        std::make_pair(s_ch, y[2 * y_ind][0]),
-                                        std::make_pair(-s_ch, y[2 * y_ind][1]),
-                                    };
-                                    math::polynomial<typename FRI::field_type::value_type> interpolant_l =
-                                            math::lagrange_interpolation(interpolation_points_l);
-
-                                    ind0 = s_indices[2 * y_ind + 1][0] < s_indices[2 * y_ind + 1][1] ? 0 : 1;
-                                    s_ch = s[2*y_ind + 1][ind0];
-                                    std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_r{
-                                        std::make_pair(s_ch, y[2 * y_ind + 1][0]),
-                                        std::make_pair(-s_ch, y[2 * y_ind + 1][1]),
-                                    };
-                                    math::polynomial<typename FRI::field_type::value_type> interpolant_r =
-                                            math::lagrange_interpolation(interpolation_points_r);
-
-                                    new_domain_size /= FRI::m;
-
-                                    std::size_t interpolant_index_l = s_indices_next[y_ind][0];
-                                    std::size_t interpolant_index_r = s_indices_next[y_ind][1];
-
-                                    if( interpolant_index_l < interpolant_index_r){
-                                        y_next[y_ind][0] = interpolant_l.evaluate(alphas[t]);
-                                        y_next[y_ind][1] = interpolant_r.evaluate(alphas[t]);
-                                    } else {
-                                        y_next[y_ind][0] = interpolant_r.evaluate(alphas[t]);
-                                        y_next[y_ind][1] = interpolant_l.evaluate(alphas[t]);
-                                    }
+                    // The denominators of all the queries are inverted at once.
+                    const std::size_t query_denominators_amount = poly_ids.size() * (1 << fri_params.step_list[0]);
+                    std::vector<typename FRI::field_type::value_type> denominator_inverses(
+                        fri_params.lambda * query_denominators_amount);
+                    parallel_for(0, fri_params.lambda,
+                        [&fri_params, &denominators, &x_indices, &denominator_inverses, query_denominators_amount](
+                                std::size_t query_id) {
+                            auto [s, s_indices] = calculate_s<FRI>(
+                                x_indices[query_id], fri_params.step_list[0], fri_params.D[0]);
+                            auto query_inverses = denominator_inverses.begin() + query_id * query_denominators_amount;
+                            for (std::size_t p = 0; p < denominators.size(); p++) {
+                                for (std::size_t j = 0; j < s.size(); j++) {
+                                    std::size_t id0 = s_indices[j][0] < s_indices[j][1] ? 0 : 1;
+                                    *query_inverses++ = denominators[p].evaluate(s[j][id0]);
+                                    *query_inverses++ = denominators[p].evaluate(s[j][1 - id0]);
                                 }
-                                x = x * x;
-                                y = y_next;
-                            }
-                            domain_size = fri_params.D[t]->size();
-                            x_index %= domain_size;
-                            x = fri_params.D[t]->get_domain_element(x_index);
-                            std::tie(s, s_indices) = calculate_s<FRI>(
-                                x_index, fri_params.step_list[i],
-                                fri_params.D[t]);
-
-                            std::size_t ind0 = s_indices[0][0] < s_indices[0][1] ? 0 : 1;
-                            auto s_ch = s[0][ind0];
-                            std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points{
-                                std::make_pair(s_ch, y[0][0]),
-                                std::make_pair(-s_ch, y[0][1]),
-                            };
-                            math::polynomial<typename FRI::field_type::value_type> interpolant_poly =
-                                    math::lagrange_interpolation(interpolation_points);
-                            auto interpolant = interpolant_poly.evaluate(alphas[t]);
-
-                            std::size_t ind = s_indices[0][ind0] % (fri_params.D[t]->size()/2) < fri_params.D[t]->size() / 4 ? 0 : 1;
-                            if (interpolant != query_proof.round_proofs[i].y[0][ind]) {
-                                return false;
                             }
+                        }, ThreadPool::PoolLevel::HIGH);
+                    math::batch_inverse(denominator_inverses);
 
-                            // For the last round we check final polynomial nor colinear_check
-                            y = query_proof.round_proofs[i].y;
-                            if (i < fri_params.step_list.size() - 1) {
-                                t++;
-                                domain_size = fri_params.D[t]->size();
-                                x_index %= domain_size;
-                                x = fri_params.D[t]->get_domain_element(x_index);
+                    std::atomic<bool> queries_valid(true);
+                    parallel_for(0, fri_params.lambda,
+                        [&](std::size_t query_id) {
+                            if (!verify_query<FRI>(
+                                    proof, query_id, x_indices[query_id], fri_params, commitments, theta, poly_ids,
+                                    combined_U, &denominator_inverses[query_id * query_denominators_amount], alphas)) {
+                                queries_valid = false;
                             }
-                        }
-
-                        // Final polynomial check
-                        x_index %= fri_params.D[t]->size();
-                        x = fri_params.D[t]->get_domain_element(x_index);
-                        x = x * x;
-                        std::size_t ind = x_index % (fri_params.D[t]->size() / 2) < fri_params.D[t]->size() / 4 ? 0 : 1;
-                        if (y[0][ind] != proof.final_polynomial.evaluate(x)) {
-                            return false;
-                        }
-                        if (y[0][1-ind] != proof.final_polynomial.evaluate(-x)) {
-                            return false;
-                        }
-                    }
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                    return true;
+                    return queries_valid;
                 }
             }    // namespace algorithms
         }        // namespace zk
@@ -32,7 +32,10 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <array>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include <nil/crypto3/random/algebraic_engine.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
@@ -45,6 +48,44 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    // Nonces a worker takes from the shared counter at once. Large enough that the counter and the
+                    // stop flag are touched rarely and the hash lanes stay full, small enough that all the workers
+                    // stop soon after a hit.
+                    static constexpr std::size_t GRINDING_BATCH_SIZE = 1 << 10;
+
+                    /*
+                     * Looks for an offset i that passes the check, running on all the workers of the pool. The
+                     * workers take batches of offsets from a shared counter, so faster workers simply take more
+                     * batches and there are no rounds to wait for. check_batch(begin, end) returns the first offset
+                     * of [begin, end) that passes, or end.
+                     */
+                    template<typename CheckBatchFunction>
+                    std::size_t grind(CheckBatchFunction check_batch) {
+                        std::atomic<std::size_t> next_offset = 0;
+                        std::atomic<bool> challenge_found = false;
+                        std::atomic<std::size_t> found_offset = 0;
+
+                        const std::size_t workers = ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
+                        parallel_for(0, workers,
+                            [&check_batch, &next_offset, &challenge_found, &found_offset](std::size_t) {
+                                while (!challenge_found.load(std::memory_order_relaxed)) {
+                                    const std::size_t begin = next_offset.fetch_add(GRINDING_BATCH_SIZE);
+                                    const std::size_t end = begin + GRINDING_BATCH_SIZE;
+                                    const std::size_t i = check_batch(begin, end);
+                                    if (i != end) {
+                                        bool expected = false;
+                                        if (challenge_found.compare_exchange_strong(expected, true)) {
+                                            found_offset = i;
+                                        }
+                                    }
+                                }
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                        return found_offset;
+                    }
+                }    // namespace detail
+
                 template<typename TranscriptHashType, typename OutType = std::uint32_t>
                 class proof_of_work {
                 public:
@@ -67,44 +108,28 @@ namespace nil {
                         output_type mask = grinding_bits > 0 ? ( 1ULL << grinding_bits ) - 1 : 0;
                         output_type pow_seed = std::rand();
 
-                        /* Enough work for ~ two minutes on 48 cores, keccak<512> */
-                        std::size_t per_block = 1 << 30;
-
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
-
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
-                                        transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(to_byte_array(pow_seed + i));
-                                        OutType pow_result = tmp_transcript.template int_challenge<OutType>();
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
-                                        }
-                                        ++i;
+                        // The transcript is only read, each batch of nonces is hashed over its current state.
+                        std::size_t pow_value_offset = detail::grind(
+                            [&transcript, &pow_seed, &mask](std::size_t begin, std::size_t end) {
+                                std::vector<std::array<std::uint8_t, sizeof(OutType)>> nonces;
+                                nonces.reserve(end - begin);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    nonces.push_back(to_byte_array(pow_seed + i));
+                                }
+                                std::vector<OutType> pow_results(nonces.size());
+                                std::as_const(transcript).template int_challenges_after_each<OutType>(
+                                    nonces, pow_results.begin());
+                                for (std::size_t k = 0; k < pow_results.size(); ++k) {
+                                    if ((pow_results[k] & mask) == 0) {
+                                        return begin + k;
                                     }
-                                }, ThreadPool::PoolLevel::LOW));
+                                }
+                                return end;
+                            });
 
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
-                        }
-
-                        transcript(to_byte_array(pow_seed + (std::size_t)pow_value_offset));
+                        transcript(to_byte_array(pow_seed + pow_value_offset));
                         transcript.template int_challenge<OutType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_seed + pow_value_offset;
                     }
 
                     static inline bool verify(transcript_type &transcript, output_type proof_of_work, std::size_t grinding_bits = 16) {
@@ -138,44 +163,28 @@ namespace nil {
                                 ((integral_type(1) << GrindingBits) - 1) << (FieldType::modulus_bits - GrindingBits)
                                 : 0);
 
-                        /* Enough work for ~ two minutes on 48 cores, poseidon<pallas> */
-                        std::size_t per_block = 1 << 23;
-
-                        std::atomic<bool> challenge_found = false;
-                        std::atomic<std::size_t> pow_value_offset;
-
-                        while( true ) {
-                            wait_for_all(parallel_run_in_chunks<void>(
-                                per_block,
-                                [&transcript, &pow_seed, &challenge_found, &pow_value_offset, &mask](std::size_t pow_start, std::size_t pow_finish) {
-                                    std::size_t i = pow_start;
-                                    while ( i < pow_finish ) {
-                                        if (challenge_found) {
-                                            break;
-                                        }
-                                        transcript_type tmp_transcript = transcript;
-                                        tmp_transcript(pow_seed + i);
-                                        integral_type pow_result = integral_type(tmp_transcript.template challenge<FieldType>().data);
-                                        if ( ((pow_result & mask) == 0) && !challenge_found ) {
-                                            bool expected = false;
-                                            if (challenge_found.compare_exchange_strong(expected, true)) {
-                                                pow_value_offset = i;
-                                            }
-                                            break;
-                                        }
-                                        ++i;
+                        // The transcript is only read, each batch of nonces is hashed over its current state.
+                        std::size_t pow_value_offset = detail::grind(
+                            [&transcript, &pow_seed, &mask](std::size_t begin, std::size_t end) {
+                                std::vector<value_type> nonces;
+                                nonces.reserve(end - begin);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    nonces.push_back(pow_seed + i);
+                                }
+                                std::vector<value_type> pow_results(nonces.size());
+                                std::as_const(transcript).template challenges_after_each<FieldType>(
+                                    nonces, pow_results.begin());
+                                for (std::size_t k = 0; k < pow_results.size(); ++k) {
+                                    if ((integral_type(pow_results[k].data) & mask) == 0) {
+                                        return begin + k;
                                     }
-                                }, ThreadPool::PoolLevel::LOW));
-
-                            if (challenge_found) {
-                                break;
-                            }
-                            pow_seed += per_block;
-                        }
+                                }
+                                return end;
+                            });
 
-                        transcript(pow_seed + (std::size_t)pow_value_offset);
+                        transcript(pow_seed + pow_value_offset);
                         transcript.template challenge<FieldType>();
-                        return pow_seed + (std::size_t)pow_value_offset;
+                        return pow_seed + pow_value_offset;
                     }
 
                     static inline bool verify(transcript_type &transcript, value_type proof_of_work, std::size_t GrindingBits=16) {
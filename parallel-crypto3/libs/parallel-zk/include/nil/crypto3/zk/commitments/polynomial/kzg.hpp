@@ -611,7 +611,11 @@ namespace nil {
 
                     auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                     auto factor = CommitmentSchemeType::scalar_value_type::one();
-                    auto left_side_pairing = CommitmentSchemeType::gt_value_type::one();
+
+                    // prod_i e(left_i, right_i) == e(proof, right) is checked as
+                    // prod_i e(left_i, right_i) * e(-proof, right) == 1 with one final exponentiation.
+                    std::vector<typename CommitmentSchemeType::single_commitment_type> g1_elements;
+                    std::vector<typename CommitmentSchemeType::verification_key_type> g2_elements;
 
                     for (std::size_t i = 0; i < public_key.commits.size(); ++i) {
                         auto r_commit = commit_one<CommitmentSchemeType>(params, public_key.r[i]);
@@ -623,22 +627,19 @@ namespace nil {
                             assert(right == CommitmentSchemeType::verification_key_type::one());
                         }
 
-                        auto left_right = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(left, right);
-                        if (!left_right) {
-                            return false;
-                        }
-                        left_side_pairing = left_side_pairing * (*left_right);
+                        g1_elements.push_back(left);
+                        g2_elements.push_back(right);
                         factor = factor * gamma;
                     }
 
-                    auto right = commit_g2<CommitmentSchemeType>(params, create_polynom_by_zeros<CommitmentSchemeType>( public_key.T));
-                    auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(proof, right);
+                    g1_elements.push_back(-proof);
+                    g2_elements.push_back(commit_g2<CommitmentSchemeType>(
+                            params, create_polynom_by_zeros<CommitmentSchemeType>(public_key.T)));
 
-                    if (!right_side_pairing) {
-                        return false;
-                    }
+                    auto pairing_product =
+                        algebra::multi_pair_reduced<typename CommitmentSchemeType::curve_type>(g1_elements, g2_elements);
 
-                    return left_side_pairing == *right_side_pairing;
+                    return pairing_product && *pairing_product == CommitmentSchemeType::gt_value_type::one();
                 }
             } // namespace algorithms
 
@@ -832,7 +833,11 @@ namespace nil {
 
                         auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                         auto factor = CommitmentSchemeType::scalar_value_type::one();
-                        auto left_side_accum = CommitmentSchemeType::gt_value_type::one();
+
+                        // The pairing equation is checked as prod_i e(g1_elements[i], g2_elements[i]) == 1
+                        // with one final exponentiation.
+                        std::vector<typename curve_type::template g1_type<>::value_type> g1_elements;
+                        std::vector<typename curve_type::template g2_type<>::value_type> g2_elements;
 
                         for (const auto &it: this->_commitments) {
                             auto k = it.first;
@@ -851,29 +856,19 @@ namespace nil {
                                     (_params, this->get_U(k, i));
 
                                 auto diffpoly = set_difference_polynom(_merged_points, this->_points.at(k)[i]);
-                                auto diffpoly_commitment = commit_g2(diffpoly);
-
-                                auto left_side_pairing = nil::crypto3::algebra::pair_reduced<curve_type>
-                                    (factor * (i_th_commitment - U_commit), diffpoly_commitment);
-                                if (!left_side_pairing) {
-                                    return false;
-                                }
 
-                                left_side_accum = left_side_accum * (*left_side_pairing);
+                                g1_elements.push_back(factor * (i_th_commitment - U_commit));
+                                g2_elements.push_back(commit_g2(diffpoly));
                                 factor *= gamma;
                             }
                         }
 
-                        auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(
-                                proof.kzg_proof,
-                                commit_g2(this->get_V(this->_merged_points))
-                        );
+                        g1_elements.push_back(-proof.kzg_proof);
+                        g2_elements.push_back(commit_g2(this->get_V(this->_merged_points)));
 
-                        if (!right_side_pairing) {
-                            return false;
-                        }
+                        auto pairing_product = algebra::multi_pair_reduced<curve_type>(g1_elements, g2_elements);
 
-                        return left_side_accum == *right_side_pairing;
+                        return pairing_product && *pairing_product == CommitmentSchemeType::gt_value_type::one();
                     }
 
                     const params_type &get_commitment_params() const {
@@ -223,39 +223,32 @@ namespace nil {
                         BOOST_ASSERT(wkey.has_correct_len(std::distance(b_first, b_last)));
                         BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
 
-                        // (A * v)
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        // (B * v)
-                        gt_value_type t2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.a.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.a.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t2 = t2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.b.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.b.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u2 = u2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        // (A * v)(w * B)
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1 * t2),
-                                              algebra::final_exponentiation<curve_type>(u1 * u2));
+                        std::vector<typename pairing::g1_precomputed_type> prec_a, prec_wa, prec_wb;
+                        std::vector<typename pairing::g2_precomputed_type> prec_b, prec_va, prec_vb;
+                        for (InputG1Iterator a_it = a_first; a_it != a_last; ++a_it) {
+                            prec_a.emplace_back(pairing::precompute_g1::process(*a_it));
+                        }
+                        for (InputG2Iterator b_it = b_first; b_it != b_last; ++b_it) {
+                            prec_b.emplace_back(pairing::precompute_g2::process(*b_it));
+                        }
+                        for (std::size_t i = 0; i < prec_a.size(); ++i) {
+                            prec_va.emplace_back(pairing::precompute_g2::process(vkey.a[i]));
+                            prec_vb.emplace_back(pairing::precompute_g2::process(vkey.b[i]));
+                            prec_wa.emplace_back(pairing::precompute_g1::process(wkey.a[i]));
+                            prec_wb.emplace_back(pairing::precompute_g1::process(wkey.b[i]));
+                        }
+
+                        // (A * v)(w * B), all the pairs of each product go through one Miller loop
+                        prec_wa.insert(prec_wa.begin(), prec_a.begin(), prec_a.end());
+                        prec_va.insert(prec_va.end(), prec_b.begin(), prec_b.end());
+                        gt_value_type t = algebra::multi_miller_loop<curve_type>(prec_wa, prec_va);
+
+                        prec_wb.insert(prec_wb.begin(), prec_a.begin(), prec_a.end());
+                        prec_vb.insert(prec_vb.end(), prec_b.begin(), prec_b.end());
+                        gt_value_type u = algebra::multi_miller_loop<curve_type>(prec_wb, prec_vb);
+
+                        return std::make_pair(algebra::final_exponentiation<curve_type>(t).value(),
+                                              algebra::final_exponentiation<curve_type>(u).value());
                     }
 
                     /// Commits to a single vector of G1 elements in the following way:
@@ -268,22 +261,21 @@ namespace nil {
                     static output_type single(const vkey_type &vkey, InputG1Iterator a_first, InputG1Iterator a_last) {
                         BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
 
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1),
-                                              algebra::final_exponentiation<curve_type>(u1));
+                        std::vector<typename pairing::g1_precomputed_type> prec_a;
+                        std::vector<typename pairing::g2_precomputed_type> prec_va, prec_vb;
+                        for (InputG1Iterator a_it = a_first; a_it != a_last; ++a_it) {
+                            prec_a.emplace_back(pairing::precompute_g1::process(*a_it));
+                        }
+                        for (std::size_t i = 0; i < prec_a.size(); ++i) {
+                            prec_va.emplace_back(pairing::precompute_g2::process(vkey.a[i]));
+                            prec_vb.emplace_back(pairing::precompute_g2::process(vkey.b[i]));
+                        }
+
+                        gt_value_type t1 = algebra::multi_miller_loop<curve_type>(prec_a, prec_va);
+                        gt_value_type u1 = algebra::multi_miller_loop<curve_type>(prec_a, prec_vb);
+
+                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1).value(),
+                                              algebra::final_exponentiation<curve_type>(u1).value());
                     }
                 };
             }    // namespace commitments
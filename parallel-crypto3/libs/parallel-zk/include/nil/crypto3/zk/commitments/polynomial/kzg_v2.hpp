@@ -358,13 +358,12 @@ namespace nil {
                         F -= rsum * CommitmentSchemeType::single_commitment_type::one();
                         F -= this->get_V(_merged_points).evaluate(theta_2) * proof.pi_1;
 
-                        auto left_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (F + theta_2 * proof.pi_2, verification_key_type::one());
+                        // e(F + theta_2 * pi_2, g2) == e(pi_2, vk) with one final exponentiation
+                        auto pairing_product = nil::crypto3::algebra::multi_pair_reduced<curve_type>(
+                                {F + theta_2 * proof.pi_2, -proof.pi_2},
+                                {verification_key_type::one(), _params.verification_key[1]});
 
-                        auto right_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (proof.pi_2, _params.verification_key[1]);
-
-                        return left_side_pairing == right_side_pairing;
+                        return pairing_product && *pairing_product == CommitmentSchemeType::gt_value_type::one();
                     }
 
                     const params_type &get_commitment_params() const {
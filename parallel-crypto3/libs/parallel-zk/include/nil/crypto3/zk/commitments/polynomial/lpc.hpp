@@ -99,16 +99,16 @@ namespace nil {
                     void set_fixed_polys_values(const preprocessed_data_type& value) {_fixed_polys_values = value;}
 
                     // This constructor is normally used from marshalling, to recover the LPC state from a file.
-                    // Maybe we want the move variant of this constructor.
+                    // Polynomials and trees are the bulk of the state, pass them as rvalues to avoid copying.
                     lpc_commitment_scheme(
-                            const polys_evaluator_type& polys_evaluator,
-                            const std::map<std::size_t, precommitment_type>& trees,
+                            polys_evaluator_type polys_evaluator,
+                            std::map<std::size_t, precommitment_type> trees,
                             const typename fri_type::params_type& fri_params,
                             const value_type& etha,
                             const std::map<std::size_t, bool>& batch_fixed,
                             const preprocessed_data_type& fixed_polys_values)
-                        : polys_evaluator_type(polys_evaluator)
-                        , _trees(trees)
+                        : polys_evaluator_type(std::move(polys_evaluator))
+                        , _trees(std::move(trees))
                         , _fri_params(fri_params)
                         , _etha(etha)
                         , _batch_fixed(batch_fixed)
@@ -376,9 +376,8 @@ namespace nil {
                             for(std::size_t batch_index = 0; batch_index < this->_z.get_batches().size(); ++batch_index) {
                                 Q_normal += Q_normal_parts[point_index][batch_index];
                             }
-                            auto const &point = points[point_index];
-                            math::polynomial<value_type> V = {-point, 1};
-                            Q_normal = Q_normal / V;
+                            // Division by V = X - point, the remainder is dropped as before.
+                            math::divide_by_linear_factor(Q_normal, Q_normal, points[point_index]);
                         }, ThreadPool::PoolLevel::HIGH);
 
                         for (const auto& Q_normal: Q_normals) {
@@ -399,8 +398,6 @@ namespace nil {
                             if( _batch_fixed.find(i) == _batch_fixed.end() || !_batch_fixed[i] )
                                 return;
                             math::polynomial<value_type>& Q_normal = Q_normals[batch_idx];
-                            auto point = _etha;
-                            math::polynomial<value_type> V = {-point, 1u};
 
                             for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++){
                                 math::polynomial<value_type> g_normal = (*polys_coefficients_ptr)[i][j];
@@ -409,13 +406,16 @@ namespace nil {
                                 Q_normal -= _fixed_polys_values[i][j] * theta_acc;
                                 theta_acc *= theta;
                             }
-
-                            Q_normal = Q_normal / V;
                         }, ThreadPool::PoolLevel::HIGH);
 
+                        // All the fixed batches are divided by the same V = X - _etha, so we sum them up first
+                        // and divide once.
+                        math::polynomial<value_type> Q_etha;
                         for (const auto& Q_normal: Q_normals) {
-                            combined_Q_normal += Q_normal;
+                            Q_etha += Q_normal;
                         }
+                        math::divide_by_linear_factor(Q_etha, Q_etha, _etha);
+                        combined_Q_normal += Q_etha;
 
                         if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
                             combined_Q.from_coefficients(combined_Q_normal);
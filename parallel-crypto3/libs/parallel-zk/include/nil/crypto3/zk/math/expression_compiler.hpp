@@ -0,0 +1,396 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a compiled form of math::expression, used for evaluating the same
+// expression over many rows of column values.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_ZK_MATH_EXPRESSION_COMPILER_HPP
+#define PARALLEL_CRYPTO3_ZK_MATH_EXPRESSION_COMPILER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * An expression lowered to a linear sequence of register-based instructions. Variables are resolved
+             * to dense indices, so the evaluator takes a plain array of column pointers instead of looking up
+             * every variable in a map. Equal subexpressions are computed once: each instruction is hashed by
+             * its opcode and operands, commutative operands are ordered, and constants are folded.
+             *
+             * The program is evaluated over blocks of rows, every instruction runs over the whole block before
+             * the next one starts, so the inner loops are plain field operations over contiguous arrays.
+             */
+            template<typename VariableType>
+            class compiled_expression {
+            public:
+                using variable_type = VariableType;
+                using value_type = typename VariableType::assignment_type;
+
+                enum class opcode : std::uint8_t {
+                    ADD = 0,
+                    SUB = 1,
+                    MULT = 2,
+                    POW = 3
+                };
+
+                enum class operand_kind : std::uint8_t {
+                    VARIABLE = 0,
+                    CONSTANT = 1,
+                    REGISTER = 2
+                };
+
+                struct operand {
+                    operand_kind kind;
+                    std::uint32_t index;
+
+                    bool operator==(const operand& other) const {
+                        return kind == other.kind && index == other.index;
+                    }
+                    bool operator<(const operand& other) const {
+                        return std::tie(kind, index) < std::tie(other.kind, other.index);
+                    }
+                };
+
+                struct instruction {
+                    opcode op;
+                    operand left;
+                    operand right;
+                    // Register the result is written to.
+                    std::uint32_t result;
+                    // Only used by POW.
+                    std::size_t power;
+                };
+
+                // Number of rows processed by each instruction at once.
+                static constexpr std::size_t block_size = 256;
+
+                compiled_expression(const math::expression<VariableType>& expr) {
+                    compiler c(*this);
+                    output = boost::apply_visitor(c, expr.get_expr());
+                    allocate_registers(c.ssa_instructions);
+                }
+
+                // Variables of the expression, in the order the column pointers must be given to 'evaluate'.
+                const std::vector<VariableType>& get_variables() const {
+                    return variables;
+                }
+
+                const std::vector<instruction>& get_instructions() const {
+                    return instructions;
+                }
+
+                std::size_t get_registers_count() const {
+                    return registers_count;
+                }
+
+                /*
+                 * Evaluates the expression on rows [begin, end).
+                 * @param columns - columns[i] points to the values of get_variables()[i], indexed by row.
+                 * @param out - the result for row j is written to out[j].
+                 */
+                void evaluate(const std::vector<const value_type*>& columns,
+                              std::size_t begin, std::size_t end, value_type* out) const {
+                    if (columns.size() != variables.size()) {
+                        throw std::invalid_argument("Number of columns does not match the compiled expression.");
+                    }
+                    std::vector<value_type> registers(registers_count * block_size);
+
+                    for (std::size_t block_begin = begin; block_begin < end; block_begin += block_size) {
+                        std::size_t rows = std::min(block_size, end - block_begin);
+
+                        for (const auto& instr : instructions) {
+                            value_type* dst = &registers[instr.result * block_size];
+                            const value_type* left = resolve(instr.left, columns, registers, block_begin);
+
+                            if (instr.op == opcode::POW) {
+                                for (std::size_t r = 0; r < rows; ++r) {
+                                    dst[r] = left[r].pow(instr.power);
+                                }
+                                continue;
+                            }
+
+                            const value_type* right = resolve(instr.right, columns, registers, block_begin);
+                            // Constants are never combined with each other, they are folded during compilation.
+                            if (instr.left.kind == operand_kind::CONSTANT) {
+                                run_binary_op<true, false>(instr.op, dst, left, right, rows);
+                            } else if (instr.right.kind == operand_kind::CONSTANT) {
+                                run_binary_op<false, true>(instr.op, dst, left, right, rows);
+                            } else {
+                                run_binary_op<false, false>(instr.op, dst, left, right, rows);
+                            }
+                        }
+
+                        const value_type* result = resolve(output, columns, registers, block_begin);
+                        if (output.kind == operand_kind::CONSTANT) {
+                            std::fill(out + block_begin, out + block_begin + rows, *result);
+                        } else {
+                            std::copy(result, result + rows, out + block_begin);
+                        }
+                    }
+                }
+
+            private:
+                struct instruction_key_hash {
+                    std::size_t operator()(const std::tuple<opcode, operand, operand, std::size_t>& key) const {
+                        std::size_t result = static_cast<std::size_t>(std::get<0>(key));
+                        boost::hash_combine(result, static_cast<std::size_t>(std::get<1>(key).kind));
+                        boost::hash_combine(result, std::get<1>(key).index);
+                        boost::hash_combine(result, static_cast<std::size_t>(std::get<2>(key).kind));
+                        boost::hash_combine(result, std::get<2>(key).index);
+                        boost::hash_combine(result, std::get<3>(key));
+                        return result;
+                    }
+                };
+
+                // Lowers the expression tree into SSA form, one fresh register per instruction.
+                class compiler : public boost::static_visitor<operand> {
+                public:
+                    compiler(compiled_expression& program)
+                        : program(program) {
+                    }
+
+                    operand operator()(const math::term<VariableType>& term) {
+                        // Sorting the variables makes equal products share their prefixes.
+                        auto vars = term.get_vars();
+                        std::sort(vars.begin(), vars.end());
+
+                        operand result = constant(term.get_coeff());
+                        for (const auto& var : vars) {
+                            result = emit(opcode::MULT, result, variable(var));
+                        }
+                        return result;
+                    }
+
+                    operand operator()(const math::pow_operation<VariableType>& pow) {
+                        operand base = boost::apply_visitor(*this, pow.get_expr().get_expr());
+                        std::size_t power = pow.get_power();
+                        if (power == 0)
+                            return constant(value_type::one());
+                        if (power == 1)
+                            return base;
+                        if (base.kind == operand_kind::CONSTANT)
+                            return constant(program.constants[base.index].pow(power));
+                        return emit(opcode::POW, base, base, power);
+                    }
+
+                    operand operator()(const math::binary_arithmetic_operation<VariableType>& op) {
+                        operand left = boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                        operand right = boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                        switch (op.get_op()) {
+                            case ArithmeticOperator::ADD:
+                                return emit(opcode::ADD, left, right);
+                            case ArithmeticOperator::SUB:
+                                return emit(opcode::SUB, left, right);
+                            case ArithmeticOperator::MULT:
+                                return emit(opcode::MULT, left, right);
+                            default:
+                                throw std::invalid_argument("ArithmeticOperator not found");
+                        }
+                    }
+
+                    std::vector<instruction> ssa_instructions;
+
+                private:
+                    operand variable(const VariableType& var) {
+                        auto it = variable_indices.find(var);
+                        if (it != variable_indices.end())
+                            return {operand_kind::VARIABLE, it->second};
+                        std::uint32_t index = program.variables.size();
+                        program.variables.push_back(var);
+                        variable_indices[var] = index;
+                        return {operand_kind::VARIABLE, index};
+                    }
+
+                    operand constant(const value_type& value) {
+                        auto it = constant_indices.find(value);
+                        if (it != constant_indices.end())
+                            return {operand_kind::CONSTANT, it->second};
+                        std::uint32_t index = program.constants.size();
+                        program.constants.push_back(value);
+                        constant_indices[value] = index;
+                        return {operand_kind::CONSTANT, index};
+                    }
+
+                    bool is_constant(const operand& o, const value_type& value) const {
+                        return o.kind == operand_kind::CONSTANT && program.constants[o.index] == value;
+                    }
+
+                    operand emit(opcode op, operand left, operand right, std::size_t power = 0) {
+                        if (op != opcode::POW) {
+                            if (left.kind == operand_kind::CONSTANT && right.kind == operand_kind::CONSTANT) {
+                                const value_type& a = program.constants[left.index];
+                                const value_type& b = program.constants[right.index];
+                                switch (op) {
+                                    case opcode::ADD:
+                                        return constant(a + b);
+                                    case opcode::SUB:
+                                        return constant(a - b);
+                                    default:
+                                        return constant(a * b);
+                                }
+                            }
+                            const value_type zero = value_type::zero();
+                            const value_type one = value_type::one();
+                            if (op == opcode::MULT) {
+                                if (is_constant(left, zero) || is_constant(right, zero))
+                                    return constant(zero);
+                                if (is_constant(left, one))
+                                    return right;
+                                if (is_constant(right, one))
+                                    return left;
+                            }
+                            if (op == opcode::ADD && is_constant(left, zero))
+                                return right;
+                            if ((op == opcode::ADD || op == opcode::SUB) && is_constant(right, zero))
+                                return left;
+                            if ((op == opcode::ADD || op == opcode::MULT) && right < left)
+                                std::swap(left, right);
+                        }
+
+                        auto key = std::make_tuple(op, left, right, power);
+                        auto it = emitted.find(key);
+                        if (it != emitted.end())
+                            return it->second;
+
+                        operand result = {operand_kind::REGISTER, static_cast<std::uint32_t>(ssa_instructions.size())};
+                        ssa_instructions.push_back({op, left, right, result.index, power});
+                        emitted[key] = result;
+                        return result;
+                    }
+
+                    compiled_expression& program;
+                    std::unordered_map<VariableType, std::uint32_t> variable_indices;
+                    std::unordered_map<value_type, std::uint32_t> constant_indices;
+                    std::unordered_map<std::tuple<opcode, operand, operand, std::size_t>, operand,
+                                       instruction_key_hash> emitted;
+                };
+
+                // Maps SSA registers to physical ones, reusing a register once its value is not needed any more.
+                // This keeps the working set of a block small enough to stay in cache.
+                void allocate_registers(std::vector<instruction>& ssa) {
+                    const std::size_t none = std::numeric_limits<std::size_t>::max();
+                    std::vector<std::size_t> last_use(ssa.size(), none);
+                    for (std::size_t i = 0; i < ssa.size(); ++i) {
+                        for (const operand* o : {&ssa[i].left, &ssa[i].right}) {
+                            if (o->kind == operand_kind::REGISTER)
+                                last_use[o->index] = i;
+                        }
+                    }
+                    if (output.kind == operand_kind::REGISTER)
+                        last_use[output.index] = ssa.size();
+
+                    std::vector<std::uint32_t> physical(ssa.size());
+                    std::vector<std::uint32_t> free_registers;
+                    registers_count = 0;
+                    instructions.clear();
+                    instructions.reserve(ssa.size());
+                    for (std::size_t i = 0; i < ssa.size(); ++i) {
+                        instruction instr = ssa[i];
+                        // Operands are released before the result is allocated, so an instruction may write to
+                        // the register of its operand. That is safe, since all operations are element-wise.
+                        for (operand* o : {&instr.left, &instr.right}) {
+                            if (o->kind == operand_kind::REGISTER) {
+                                std::uint32_t ssa_index = o->index;
+                                o->index = physical[ssa_index];
+                                if (last_use[ssa_index] == i) {
+                                    free_registers.push_back(physical[ssa_index]);
+                                    last_use[ssa_index] = none;
+                                }
+                            }
+                        }
+                        if (last_use[i] == none) {
+                            // Result is never used, this may only happen for dead code, which we do not emit.
+                            continue;
+                        }
+                        if (free_registers.empty()) {
+                            physical[i] = registers_count++;
+                        } else {
+                            physical[i] = free_registers.back();
+                            free_registers.pop_back();
+                        }
+                        instr.result = physical[i];
+                        instructions.push_back(instr);
+                    }
+                    if (output.kind == operand_kind::REGISTER)
+                        output.index = physical[output.index];
+                }
+
+                const value_type* resolve(const operand& o, const std::vector<const value_type*>& columns,
+                                          const std::vector<value_type>& registers, std::size_t block_begin) const {
+                    switch (o.kind) {
+                        case operand_kind::VARIABLE:
+                            return columns[o.index] + block_begin;
+                        case operand_kind::CONSTANT:
+                            return &constants[o.index];
+                        default:
+                            return &registers[o.index * block_size];
+                    }
+                }
+
+                template<bool LeftIsScalar, bool RightIsScalar>
+                static void run_binary_op(opcode op, value_type* dst, const value_type* left,
+                                          const value_type* right, std::size_t rows) {
+                    switch (op) {
+                        case opcode::ADD:
+                            for (std::size_t r = 0; r < rows; ++r)
+                                dst[r] = left[LeftIsScalar ? 0 : r] + right[RightIsScalar ? 0 : r];
+                            break;
+                        case opcode::SUB:
+                            for (std::size_t r = 0; r < rows; ++r)
+                                dst[r] = left[LeftIsScalar ? 0 : r] - right[RightIsScalar ? 0 : r];
+                            break;
+                        case opcode::MULT:
+                            for (std::size_t r = 0; r < rows; ++r)
+                                dst[r] = left[LeftIsScalar ? 0 : r] * right[RightIsScalar ? 0 : r];
+                            break;
+                        default:
+                            __builtin_unreachable();
+                    }
+                }
+
+                std::vector<VariableType> variables;
+                std::vector<value_type> constants;
+                std::vector<instruction> instructions;
+                std::size_t registers_count = 0;
+                operand output;
+            };
+        }    // namespace math
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_ZK_MATH_EXPRESSION_COMPILER_HPP
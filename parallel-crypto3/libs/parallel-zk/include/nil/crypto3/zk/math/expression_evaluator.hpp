@@ -35,7 +35,7 @@
 #include <boost/variant/apply_visitor.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 
@@ -73,7 +73,7 @@ namespace nil {
                                  res.degree() + val.degree() + 1}));
                         for (auto domain_size : {res_domain_size, val_domain_size, new_domain_size}) {
                             if (domains.find(domain_size) == domains.end()) {
-                                domains[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                                domains[domain_size] = get_evaluation_domain<FieldType>(domain_size);
                             }
                         }
                         res.cached_multiplication(
@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+#define PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+
+#ifdef CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+#error "You're mixing parallel and non-parallel crypto3 versions"
+#endif
+
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /**
+                 * Verifies many proofs of the same circuit. The part of the verification which depends only on the
+                 * common data, i.e. the commitment scheme setup and the transcript with the verification key
+                 * absorbed, is done once in the constructor, every proof starts from a copy of that state.
+                 * Proofs are verified in parallel. The common data, the table description and the constraint
+                 * system are referenced, not copied, and must outlive the verifier.
+                 */
+                template<typename FieldType, typename ParamsType>
+                class placeholder_batch_verifier {
+                    using verifier_type = placeholder_verifier<FieldType, ParamsType>;
+                    using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
+                    using common_data_type = typename public_preprocessor_type::preprocessed_data_type::common_data_type;
+                    using commitment_scheme_type = typename ParamsType::commitment_scheme_type;
+                    using transcript_type = typename verifier_type::transcript_type;
+
+                public:
+                    using proof_type = placeholder_proof<FieldType, ParamsType>;
+                    using public_input_type = std::vector<std::vector<typename FieldType::value_type>>;
+
+                    placeholder_batch_verifier(
+                        const common_data_type &common_data,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const commitment_scheme_type &commitment_scheme
+                    ) : common_data(common_data)
+                      , table_description(table_description)
+                      , constraint_system(constraint_system)
+                      , commitment_scheme(commitment_scheme)
+                      , transcript(verifier_type::setup(common_data, this->commitment_scheme)) {
+                    }
+
+                    bool process(const proof_type &proof) const {
+                        return verify(proof, nullptr);
+                    }
+
+                    bool process(const proof_type &proof, const public_input_type &public_input) const {
+                        return verify(proof, &public_input);
+                    }
+
+                    // Returns whether each of the proofs is valid, in the order of the proofs.
+                    std::vector<bool> process(const std::vector<proof_type> &proofs) const {
+                        return process(proofs, {});
+                    }
+
+                    // public_inputs[i] is checked against proofs[i], no public input is checked if public_inputs is empty.
+                    std::vector<bool> process(
+                        const std::vector<proof_type> &proofs,
+                        const std::vector<public_input_type> &public_inputs
+                    ) const {
+                        BOOST_ASSERT(public_inputs.empty() || public_inputs.size() == proofs.size());
+
+                        // Not std::vector<bool>, its elements can not be written from different threads.
+                        std::vector<std::uint8_t> results(proofs.size(), 0);
+                        parallel_for(0, proofs.size(),
+                            [this, &proofs, &public_inputs, &results](std::size_t i) {
+                                results[i] = verify(proofs[i], public_inputs.empty() ? nullptr : &public_inputs[i]);
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                        return std::vector<bool>(results.begin(), results.end());
+                    }
+
+                private:
+                    bool verify(const proof_type &proof, const public_input_type *public_input) const {
+                        // A malformed proof must not hide the results of the other ones.
+                        try {
+                            if (public_input != nullptr && !verifier_type::check_public_input(
+                                    common_data, proof, table_description, constraint_system, *public_input)) {
+                                return false;
+                            }
+                            commitment_scheme_type proof_commitment_scheme = commitment_scheme;
+                            transcript_type proof_transcript = transcript;
+                            return verifier_type::process(common_data, proof, table_description, constraint_system,
+                                                          proof_commitment_scheme, proof_transcript);
+                        } catch (const std::exception &e) {
+                            BOOST_LOG_TRIVIAL(info) << "Verification failed because: " << e.what();
+                            return false;
+                        }
+                    }
+
+                    const common_data_type &common_data;
+                    const plonk_table_description<FieldType> &table_description;
+                    const plonk_constraint_system<FieldType> &constraint_system;
+                    // Both are in the state left by placeholder_verifier::setup.
+                    commitment_scheme_type commitment_scheme;
+                    transcript_type transcript;
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
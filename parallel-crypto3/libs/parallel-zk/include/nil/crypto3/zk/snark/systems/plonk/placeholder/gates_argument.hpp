@@ -39,7 +39,7 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
-#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/evaluation_domain_registry.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
@@ -54,6 +54,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/expression_compiler.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
@@ -111,7 +112,7 @@ namespace nil {
                         visitor.visit(expr);
 
                         std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
-                            math::make_evaluation_domain<FieldType>(extended_domain_size);
+                            math::get_evaluation_domain<FieldType>(extended_domain_size);
 
                         parallel_for(0, variables.size(),
                             [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size, &mask_polynomial, &lagrange_0](std::size_t i) {
@@ -217,22 +218,20 @@ namespace nil {
                                 mask_polynomial, lagrange_0
                             );
 
+                            // Lower the expression once, then run the flat program over blocks of rows,
+                            // reading the columns directly instead of looking up each variable per row.
+                            math::compiled_expression<variable_type> compiled(expressions[i]);
+                            std::vector<const typename FieldType::value_type*> columns;
+                            for (const auto& var : compiled.get_variables()) {
+                                columns.push_back(&variable_values.at(var)[0]);
+                            }
+
                             polynomial_dfs_type result(extended_domain_sizes[i] - 1, extended_domain_sizes[i]);
                             wait_for_all(parallel_run_in_chunks<void>(
                                 extended_domain_sizes[i],
-                                [&variable_values, &extended_domain_sizes, &result, &expressions, i]
+                                [&compiled, &columns, &result]
                                 (std::size_t begin, std::size_t end) {
-                                    for (std::size_t j = begin; j < end; ++j) {
-                                        // Don't use cache here. In practice it's slower to maintain the cache
-                                        // than to re-compute the subexpression value when value type is field element.
-                                        math::expression_evaluator<variable_type> evaluator(
-                                            expressions[i],
-                                            [&assignments=variable_values, j]
-                                                (const variable_type &var) -> const typename FieldType::value_type& {
-                                                    return assignments[var][j];
-                                            });
-                                        result[j] = evaluator.evaluate();
-                                    }
+                                    compiled.evaluate(columns, begin, end, &result[0]);
                             }, ThreadPool::PoolLevel::HIGH));
 
                             F[0] += result;
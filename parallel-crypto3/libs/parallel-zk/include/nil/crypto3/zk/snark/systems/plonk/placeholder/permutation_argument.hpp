@@ -38,6 +38,7 @@
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 
@@ -132,9 +133,11 @@ namespace nil {
 
                         V_P[0] = FieldType::value_type::one();
 
-                        auto V_P_parts = std::make_unique<std::vector<typename FieldType::value_type>>(
-                            basic_domain->size(), FieldType::value_type::zero());
-                        parallel_for(1, basic_domain->size(), [&g_v, &h_v, &S_id, &V_P_parts](std::size_t j) {
+                        // V_P[j] = V_P[j - 1] * nom_j / denom_j. All the denominators are inverted at once,
+                        // then the running product is computed as a parallel prefix product.
+                        std::vector<typename FieldType::value_type> denoms(
+                            basic_domain->size(), FieldType::value_type::one());
+                        parallel_for(1, basic_domain->size(), [&g_v, &h_v, &S_id, &V_P, &denoms](std::size_t j) {
                             typename FieldType::value_type nom = FieldType::value_type::one();
                             typename FieldType::value_type denom = FieldType::value_type::one();
 
@@ -142,12 +145,18 @@ namespace nil {
                                 nom *= g_v[i][j - 1];
                                 denom *= h_v[i][j - 1];
                             }
-                            (*V_P_parts)[j] = nom * denom.inversed();
+                            V_P[j] = nom;
+                            denoms[j] = denom;
                         }, ThreadPool::PoolLevel::LOW);
 
-                        for (std::size_t j = 1; j < basic_domain->size(); ++j)
-                            V_P[j] = V_P[j - 1] * (*V_P_parts)[j];
-                        V_P_parts.reset(nullptr);
+                        math::batch_inverse(denoms);
+                        parallel_for(1, basic_domain->size(), [&V_P, &denoms](std::size_t j) {
+                            V_P[j] *= denoms[j];
+                        }, ThreadPool::PoolLevel::LOW);
+                        denoms.clear();
+                        denoms.shrink_to_fit();
+
+                        math::parallel_prefix_product(V_P.begin(), V_P.end());
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
                         // TODO: Better enumeration for polynomial batches
@@ -219,10 +228,12 @@ namespace nil {
                                 const auto& h = hs[i];
                                 auto reduced_g = reduce_dfs_polynomial_domain(g, basic_domain->m);
                                 auto reduced_h = reduce_dfs_polynomial_domain(h, basic_domain->m);
+                                math::batch_inverse(reduced_h.begin(),
+                                                    reduced_h.begin() + preprocessed_data.common_data.desc.usable_rows_amount);
 
                                 parallel_for(0, preprocessed_data.common_data.desc.usable_rows_amount,
                                     [&reduced_g, &reduced_h, &current_poly, &previous_poly](std::size_t j) {
-                                        current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j].inversed();
+                                        current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j];
                                     },
                                     ThreadPool::PoolLevel::LOW);
 
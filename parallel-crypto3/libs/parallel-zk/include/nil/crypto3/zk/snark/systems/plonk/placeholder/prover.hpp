@@ -243,8 +243,8 @@ namespace nil {
                         PROFILE_SCOPE("quotient_polynomial_split_dfs");
 
                         // TODO: pass max_degree parameter placeholder
-                        std::vector<polynomial_type> T_splitted = detail::split_polynomial<FieldType>(
-                            quotient_polynomial(), table_description.rows_amount - 1
+                        std::vector<polynomial_type> T_splitted = quotient_polynomial_split(
+                            table_description.rows_amount
                         );
 
                         std::size_t split_polynomial_size = std::max(
@@ -283,7 +283,13 @@ namespace nil {
                         return T_splitted_dfs;
                     }
 
-                    polynomial_type quotient_polynomial() {
+                    // Computes T = F_consolidated / Z, already split into chunks of chunk_size coefficients.
+                    // Z = X^n - 1 with n = chunk_size, so the quotient coefficients are
+                    //      T[j] = F[j + n] + F[j + 2n] + F[j + 3n] + ...,
+                    // i.e. chunk c of T is the sum of chunks c+1, c+2, ... of F. We compute these suffix sums
+                    // in parallel over the positions inside a chunk and write them directly into the chunks,
+                    // without the long division and without materializing T as a single polynomial.
+                    std::vector<polynomial_type> quotient_polynomial_split(std::size_t chunk_size) {
                         PROFILE_SCOPE("quotient_polynomial_time");
 
                         // 7.1. Get $\alpha_0, \dots, \alpha_8 \in \mathbb{F}$ from $hash(\text{transcript})$
@@ -303,12 +309,48 @@ namespace nil {
 
                         polynomial_dfs_type F_consolidated_dfs = polynomial_sum<FieldType>(std::move(F_consolidated_dfs_parts));
 
-                        polynomial_type F_consolidated_normal(F_consolidated_dfs.coefficients());
+                        std::vector<typename FieldType::value_type> F_consolidated_normal = F_consolidated_dfs.coefficients();
+                        F_consolidated_dfs = polynomial_dfs_type();
 
-                        polynomial_type T_consolidated =
-                            F_consolidated_normal / preprocessed_public_data.common_data.Z;
+                        // 7.3. Divide by Z.
+                        const std::size_t F_size = F_consolidated_normal.size();
+                        if (F_size <= chunk_size) {
+                            return {polynomial_type({FieldType::value_type::zero()})};
+                        }
+
+                        // Size of the quotient with leading zeros removed, the same as after a polynomial division.
+                        std::size_t T_size = F_size - chunk_size;
+                        std::vector<std::size_t> max_non_zero(chunk_size, 0);
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            chunk_size,
+                            [&F_consolidated_normal, &max_non_zero, F_size, chunk_size](std::size_t begin, std::size_t end) {
+                                for (std::size_t t = begin; t < end; ++t) {
+                                    typename FieldType::value_type sum = FieldType::value_type::zero();
+                                    // Walk over the positions t + m * chunk_size of F from the top. T[j - chunk_size]
+                                    // is stored in place of F[j - chunk_size], after reading the original value.
+                                    std::size_t j = t + ((F_size - 1 - t) / chunk_size) * chunk_size;
+                                    typename FieldType::value_type next = F_consolidated_normal[j];
+                                    for (; j >= chunk_size; j -= chunk_size) {
+                                        sum += next;
+                                        next = F_consolidated_normal[j - chunk_size];
+                                        F_consolidated_normal[j - chunk_size] = sum;
+                                        if (max_non_zero[t] == 0 && !sum.is_zero()) {
+                                            max_non_zero[t] = j - chunk_size + 1;
+                                        }
+                                    }
+                                }
+                            }, ThreadPool::PoolLevel::HIGH));
+                        T_size = std::min(T_size, std::max(std::size_t(1), *std::max_element(max_non_zero.begin(), max_non_zero.end())));
+
+                        std::vector<polynomial_type> T_splitted((T_size + chunk_size - 1) / chunk_size);
+                        parallel_for(0, T_splitted.size(),
+                            [&T_splitted, &F_consolidated_normal, T_size, chunk_size](std::size_t i) {
+                                auto first = F_consolidated_normal.begin() + i * chunk_size;
+                                auto last = F_consolidated_normal.begin() + std::min(T_size, (i + 1) * chunk_size);
+                                T_splitted[i] = polynomial_type(first, last);
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                        return T_consolidated;
+                        return T_splitted;
                     }
 
                     typename placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType>::prover_lookup_result
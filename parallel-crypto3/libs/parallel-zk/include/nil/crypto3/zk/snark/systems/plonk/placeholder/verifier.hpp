@@ -67,6 +67,7 @@ namespace nil {
                     constexpr static const std::size_t f_parts = 8;
 
                 public:
+                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
 
                     // TODO(martun): this function is pretty similar to the one in prover, we should de-duplicate it.
                     static void generate_evaluation_points(
@@ -156,6 +157,20 @@ namespace nil {
                         const plonk_constraint_system<FieldType> &constraint_system,
                         commitment_scheme_type& commitment_scheme,
                         const std::vector<std::vector<typename FieldType::value_type>> &public_input
+                    ){
+                        if (!check_public_input(common_data, proof, table_description, constraint_system, public_input)) {
+                            return false;
+                        }
+                        return process(common_data, proof, table_description, constraint_system, commitment_scheme);
+                    }
+
+                    // Checks that the evaluations of the public input columns in the proof match public_input.
+                    static inline bool check_public_input(
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        const placeholder_proof<FieldType, ParamsType> &proof,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const std::vector<std::vector<typename FieldType::value_type>> &public_input
                     ){
                         // TODO: process rotations for public input.
                         auto omega = common_data.basic_domain->get_domain_element(1);
@@ -187,7 +202,7 @@ namespace nil {
                                 return false;
                             }
                         }
-                        return process(common_data, proof, table_description, constraint_system, commitment_scheme);
+                        return true;
                     }
 
                     static inline bool process(
@@ -197,7 +212,20 @@ namespace nil {
                         const plonk_constraint_system<FieldType> &constraint_system,
                         commitment_scheme_type& commitment_scheme
                     ) {
+                        transcript_type transcript = setup(common_data, commitment_scheme);
+                        return process(common_data, proof, table_description, constraint_system, commitment_scheme,
+                                       transcript);
+                    }
 
+                    /**
+                     * Part of the verification which depends on the common data only: prepares the commitment scheme
+                     * and returns the transcript with the verification key absorbed. The same state is reached for
+                     * every proof of the circuit, so it may be computed once and copied.
+                     */
+                    static inline transcript_type setup(
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        commitment_scheme_type& commitment_scheme
+                    ) {
                         // We cannot add eval points unless everything is committed, so when verifying assume it's committed.
                         commitment_scheme.state_commited(FIXED_VALUES_BATCH);
                         commitment_scheme.state_commited(VARIABLE_VALUES_BATCH);
@@ -208,12 +236,7 @@ namespace nil {
 
                         commitment_scheme.set_fixed_polys_values(common_data.commitment_scheme_data);
 
-                        const std::size_t witness_columns = table_description.witness_columns;
-                        const std::size_t public_input_columns = table_description.public_input_columns;
-                        const std::size_t constant_columns = table_description.constant_columns;
-                        const std::size_t selector_columns = table_description.selector_columns;
-
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(std::vector<std::uint8_t>({}));
+                        transcript_type transcript(std::vector<std::uint8_t>({}));
 
                         transcript(common_data.vk.constraint_system_with_params_hash);
                         transcript(common_data.vk.fixed_values_commitment);
@@ -221,6 +244,23 @@ namespace nil {
                         // Setup commitment scheme. LPC adds an additional point here.
                         commitment_scheme.setup(transcript, common_data.commitment_scheme_data);
 
+                        return transcript;
+                    }
+
+                    // Verifies the proof with commitment_scheme and transcript in the state left by setup.
+                    static inline bool process(
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        const placeholder_proof<FieldType, ParamsType> &proof,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        commitment_scheme_type& commitment_scheme,
+                        transcript_type& transcript
+                    ) {
+                        const std::size_t witness_columns = table_description.witness_columns;
+                        const std::size_t public_input_columns = table_description.public_input_columns;
+                        const std::size_t constant_columns = table_description.constant_columns;
+                        const std::size_t selector_columns = table_description.selector_columns;
+
                         // 3. append witness commitments to transcript
                         transcript(proof.commitments.at(VARIABLE_VALUES_BATCH));
 
@@ -31,11 +31,17 @@
 #error "You're mixing parallel and non-parallel crypto3 versions"
 #endif
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
@@ -190,35 +196,36 @@ namespace nil {
                     // typename std::enable_if<(Hash::digest_bits >= Field::modulus_bits),
                     //                         typename Field::value_type>::type
                     typename Field::value_type challenge() {
-                        using digest_value_type = typename hash_type::digest_type::value_type;
-                        const std::size_t digest_value_bits = sizeof(digest_value_type) * CHAR_BIT;
-                        const std::size_t element_size = Field::number_bits / digest_value_bits +
-                            (Field::number_bits % digest_value_bits == 0 ? 0 : 1);
-
-                        std::array<digest_value_type, element_size> data;
                         state = hash<hash_type>(state);
-                        // TODO(martun): for now we copy 256 bits into a larger group element. For example for 
-                        // mnt6_base_field<298ul> the first 42 bits will be zero.
-                        // Use something like hash to field(h2f.hpp) for this.
-                        std::size_t count = std::min(data.size(), state.size());
-                        std::copy(state.begin(), state.begin() + count, data.begin() + data.size() - count);
-                        
-                        nil::marshalling::status_type status;
-                        boost::multiprecision::number<modular_backend_of_hash_size> raw_result = 
-                            nil::marshalling::pack(state, status);
-                        THROW_IF_ERROR_STATUS(status, "fiat_shamir_heuristic_sequential::challenge");
-                        return raw_result;
+                        return challenge_from_state<Field>(state);
                     }
 
                     template<typename Integral>
                     Integral int_challenge() {
                         state = hash<hash_type>(state);
-                        nil::marshalling::status_type status;
-                        boost::multiprecision::number<modular_backend_of_hash_size> raw_result = nil::marshalling::pack(state, status);
-                        // If we remove the next line, raw_result is a much larger number, conversion to 'Integral' will overflow
-                        // and in debug mode an assert will fire. In release mode nothing will change.
-                        raw_result &= ~Integral(0);
-                        return static_cast<Integral>(raw_result);
+                        return int_challenge_from_state<Integral>(state);
+                    }
+
+                    /*!
+                     * @brief Writes to out, for each of the inputs, the challenge<Field>() a copy of this transcript
+                     * would give after absorbing that input. No copies are made: the messages of all the inputs
+                     * are hashed together through batch_hasher, in lanes where the hash has them. Used for grinding.
+                     */
+                    template<typename Field, typename InputRange, typename OutputIterator>
+                    OutputIterator challenges_after_each(const InputRange &inputs, OutputIterator out) const {
+                        for (const auto &digest : states_after_each(inputs)) {
+                            *out++ = challenge_from_state<Field>(digest);
+                        }
+                        return out;
+                    }
+
+                    // Same as challenges_after_each(), for int_challenge<Integral>().
+                    template<typename Integral, typename InputRange, typename OutputIterator>
+                    OutputIterator int_challenges_after_each(const InputRange &inputs, OutputIterator out) const {
+                        for (const auto &digest : states_after_each(inputs)) {
+                            *out++ = int_challenge_from_state<Integral>(digest);
+                        }
+                        return out;
                     }
 
                     template<typename Field, std::size_t N>
@@ -246,7 +253,73 @@ namespace nil {
                     }
 
                 private:
-                    typename hash_type::digest_type state;
+                    typedef typename hash_type::digest_type digest_type;
+
+                    template<typename Field>
+                    static typename Field::value_type challenge_from_state(const digest_type &digest) {
+                        using digest_value_type = typename hash_type::digest_type::value_type;
+                        const std::size_t digest_value_bits = sizeof(digest_value_type) * CHAR_BIT;
+                        const std::size_t element_size = Field::number_bits / digest_value_bits +
+                            (Field::number_bits % digest_value_bits == 0 ? 0 : 1);
+
+                        std::array<digest_value_type, element_size> data;
+                        // TODO(martun): for now we copy 256 bits into a larger group element. For example for 
+                        // mnt6_base_field<298ul> the first 42 bits will be zero.
+                        // Use something like hash to field(h2f.hpp) for this.
+                        std::size_t count = std::min(data.size(), digest.size());
+                        std::copy(digest.begin(), digest.begin() + count, data.begin() + data.size() - count);
+                        
+                        nil::marshalling::status_type status;
+                        boost::multiprecision::number<modular_backend_of_hash_size> raw_result = 
+                            nil::marshalling::pack(digest, status);
+                        THROW_IF_ERROR_STATUS(status, "fiat_shamir_heuristic_sequential::challenge");
+                        return raw_result;
+                    }
+
+                    template<typename Integral>
+                    static Integral int_challenge_from_state(const digest_type &digest) {
+                        nil::marshalling::status_type status;
+                        boost::multiprecision::number<modular_backend_of_hash_size> raw_result = nil::marshalling::pack(digest, status);
+                        // If we remove the next line, raw_result is a much larger number, conversion to 'Integral' will overflow
+                        // and in debug mode an assert will fire. In release mode nothing will change.
+                        raw_result &= ~Integral(0);
+                        return static_cast<Integral>(raw_result);
+                    }
+
+                    // The bytes operator() feeds to the hash after the state.
+                    template<typename Input>
+                    static void absorbed_bytes(const Input &input, std::vector<std::uint8_t> &bytes) {
+                        if constexpr (algebra::is_curve_element<Input>::value || algebra::is_field_element<Input>::value) {
+                            nil::marshalling::status_type status;
+                            bytes = nil::marshalling::pack<nil::marshalling::option::big_endian>(input, status);
+                            THROW_IF_ERROR_STATUS(status, "fiat_shamir_heuristic_sequential::absorbed_bytes");
+                        } else {
+                            bytes.assign(std::begin(input), std::end(input));
+                        }
+                    }
+
+                    // The states the challenges are taken from, after absorbing each of the inputs into a copy of this
+                    // transcript and hashing the state once more, as challenge() does.
+                    template<typename InputRange>
+                    std::vector<digest_type> states_after_each(const InputRange &inputs) const {
+                        std::vector<digest_type> absorbed(std::size(inputs));
+                        {
+                            batch_hasher<hash_type, typename std::vector<digest_type>::iterator> hasher(absorbed.begin());
+                            std::array<std::vector<std::uint8_t>, 2> parts;
+                            parts[0].assign(state.begin(), state.end());
+                            for (const auto &input : inputs) {
+                                absorbed_bytes(input, parts[1]);
+                                hasher(parts.begin(), parts.end());
+                            }
+                            hasher.flush();
+                        }
+
+                        std::vector<digest_type> result(absorbed.size());
+                        hash_many<hash_type>(absorbed, result.begin());
+                        return result;
+                    }
+
+                    digest_type state;
                 };
 
                 // Specialize for Nil Posseidon.
@@ -326,23 +399,29 @@ namespace nil {
 
                     template<typename Integral>
                     Integral int_challenge() {
-                        auto c = challenge<field_type>();
+                        return int_challenge_from<Integral>(challenge<field_type>());
+                    }
 
-                        typename field_type::integral_type intermediate_result =
-                            static_cast<typename field_type::integral_type>(c.data);
-                        Integral result = 0u;
-                        Integral factor = 1u;
-                        size_t bytes_to_fill = sizeof(Integral);
-                        // TODO(martun): consider using export_bits here, or nil::marshalling::pack, instead of this.
-                        while (intermediate_result > 0u && bytes_to_fill != 0u) {
-                            auto last_byte = intermediate_result % 0x100u;
-                            Integral last_byte_integral = static_cast<Integral>(last_byte);
-                            result += factor * last_byte_integral;
-                            factor *= 0x100u;
-                            intermediate_result = intermediate_result / 0x100u;
-                            bytes_to_fill -= 2;
+                    /*!
+                     * @brief Writes to out, for each of the inputs, the challenge<Field>() a copy of this transcript
+                     * would give after absorbing that input. The copies of the sponge state are permuted together,
+                     * see poseidon_sponge_construction_custom::squeeze_after_each. Used for grinding.
+                     */
+                    template<typename Field, typename InputRange, typename OutputIterator>
+                    OutputIterator challenges_after_each(const InputRange &inputs, OutputIterator out) const {
+                        for (const auto &word : squeezed_after_each(inputs)) {
+                            *out++ = typename Field::value_type(word);
                         }
-                        return result;
+                        return out;
+                    }
+
+                    // Same as challenges_after_each(), for int_challenge<Integral>().
+                    template<typename Integral, typename InputRange, typename OutputIterator>
+                    OutputIterator int_challenges_after_each(const InputRange &inputs, OutputIterator out) const {
+                        for (const auto &word : squeezed_after_each(inputs)) {
+                            *out++ = int_challenge_from<Integral>(word);
+                        }
+                        return out;
                     }
 
                     template<typename Field, std::size_t N>
@@ -369,6 +448,47 @@ namespace nil {
 
                 public:
                     hashes::detail::poseidon_sponge_construction_custom<typename Hash::policy_type> sponge;
+
+                private:
+                    template<typename Integral>
+                    static Integral int_challenge_from(const typename field_type::value_type &c) {
+                        typename field_type::integral_type intermediate_result =
+                            static_cast<typename field_type::integral_type>(c.data);
+                        Integral result = 0u;
+                        Integral factor = 1u;
+                        size_t bytes_to_fill = sizeof(Integral);
+                        // TODO(martun): consider using export_bits here, or nil::marshalling::pack, instead of this.
+                        while (intermediate_result > 0u && bytes_to_fill != 0u) {
+                            auto last_byte = intermediate_result % 0x100u;
+                            Integral last_byte_integral = static_cast<Integral>(last_byte);
+                            result += factor * last_byte_integral;
+                            factor *= 0x100u;
+                            intermediate_result = intermediate_result / 0x100u;
+                            bytes_to_fill -= 2;
+                        }
+                        return result;
+                    }
+
+                    // The words operator() absorbs into the sponge.
+                    template<typename Input>
+                    static typename hash_type::digest_type absorbed_word(const Input &input) {
+                        if constexpr (std::is_same<Input, typename hash_type::digest_type>::value) {
+                            return input;
+                        } else {
+                            return static_cast<typename hash_type::digest_type>(hash<hash_type>(input));
+                        }
+                    }
+
+                    template<typename InputRange>
+                    std::vector<typename hash_type::digest_type> squeezed_after_each(const InputRange &inputs) const {
+                        std::vector<typename hash_type::digest_type> words;
+                        words.reserve(std::size(inputs));
+                        for (const auto &input : inputs) {
+                            words.push_back(absorbed_word(input));
+                        }
+                        sponge.squeeze_after_each(words.begin(), words.end(), words.begin());
+                        return words;
+                    }
                 };
 
             }    // namespace transcript
@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE placeholder_batch_verifier_benchmark_test
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_verifier.hpp>
+
+#include "../systems/plonk/placeholder/circuits.hpp"
+#include "../systems/plonk/placeholder/placeholder_test_runner.hpp"
+
+// Proves circuit_test_fib once, the benchmarks verify copies of that proof.
+struct F {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using hash_type = hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>;
+    using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type>;
+    using placeholder_params_type = typename test_runner_type::lpc_placeholder_params_type;
+    using lpc_scheme_type = typename test_runner_type::lpc_scheme_type;
+    using public_preprocessor_type = placeholder_public_preprocessor<field_type, placeholder_params_type>;
+    using private_preprocessor_type = placeholder_private_preprocessor<field_type, placeholder_params_type>;
+    using batch_verifier_type = placeholder_batch_verifier<field_type, placeholder_params_type>;
+    using proof_type = typename batch_verifier_type::proof_type;
+
+    F() : runner(circuit_test_fib<field_type, 100>())
+        , lpc_scheme(runner.fri_params)
+        , preprocessed_public_data(public_preprocessor_type::process(
+            runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme))
+        , proof(prove()) {
+    }
+
+    proof_type prove() {
+        auto preprocessed_private_data = private_preprocessor_type::process(
+            runner.constraint_system, runner.assignments.private_table(), runner.desc);
+        return placeholder_prover<field_type, placeholder_params_type>::process(
+            preprocessed_public_data, std::move(preprocessed_private_data), runner.desc, runner.constraint_system,
+            lpc_scheme);
+    }
+
+    batch_verifier_type make_batch_verifier() const {
+        // The prover's commitment scheme must not be reused by the verifier.
+        return batch_verifier_type(preprocessed_public_data.common_data, runner.desc, runner.constraint_system,
+                                   lpc_scheme_type(runner.fri_params));
+    }
+
+    test_runner_type runner;
+    lpc_scheme_type lpc_scheme;
+    typename public_preprocessor_type::preprocessed_data_type preprocessed_public_data;
+    proof_type proof;
+};
+
+BOOST_FIXTURE_TEST_SUITE(placeholder_batch_verifier_benchmark_test_suite, F)
+
+#define PLACEHOLDER_BATCH_VERIFIER_BENCHMARK_TEST_CASE(proofs_amount, num_iterations)            \
+    BENCHMARK_AUTO_TEST_CASE(placeholder_batch_verifier_##proofs_amount##_test, num_iterations) { \
+        std::vector<proof_type> proofs(proofs_amount, proof);                                     \
+        items_per_iteration = proofs.size();                                                      \
+        items_name = "proofs";                                                                    \
+                                                                                                  \
+        START_TIMER("placeholder batch verifier, " #proofs_amount " proofs")                      \
+        batch_verifier_type batch_verifier = make_batch_verifier();                               \
+        std::vector<bool> results = batch_verifier.process(proofs);                               \
+        STOP_TIMER("placeholder batch verifier, " #proofs_amount " proofs")                       \
+                                                                                                  \
+        BOOST_CHECK(std::find(results.begin(), results.end(), false) == results.end());           \
+    }
+
+PLACEHOLDER_BATCH_VERIFIER_BENCHMARK_TEST_CASE(1, 10)
+PLACEHOLDER_BATCH_VERIFIER_BENCHMARK_TEST_CASE(16, 5)
+PLACEHOLDER_BATCH_VERIFIER_BENCHMARK_TEST_CASE(256, 3)
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Dmitrii Tabalin <d.tabalin@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE proof_of_work_benchmark_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/polynomial/proof_of_work.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+using namespace nil::crypto3;
+
+using field_type = algebra::curves::pallas::base_field_type;
+using keccak_type = hashes::keccak_1600<256>;
+using poseidon_type = hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>;
+
+BOOST_AUTO_TEST_SUITE(proof_of_work_benchmark_test_suite)
+
+// One proof takes 2^grinding_bits hashes on average, that is the throughput reported.
+#define POW_BENCHMARK_TEST_CASE(name, pow_type, hash_type, grinding_bits, num_iterations)  \
+    BENCHMARK_AUTO_TEST_CASE(name##_##grinding_bits##_test, num_iterations) {             \
+        items_per_iteration = std::size_t(1) << grinding_bits;                            \
+        items_name = "hashes";                                                            \
+        zk::transcript::fiat_shamir_heuristic_sequential<hash_type> transcript;           \
+        auto old_transcript = transcript;                                                 \
+                                                                                          \
+        START_TIMER(#name ", " #grinding_bits " bits")                                    \
+        auto result = pow_type::generate(transcript, grinding_bits);                      \
+        STOP_TIMER(#name ", " #grinding_bits " bits")                                     \
+                                                                                          \
+        BOOST_CHECK(pow_type::verify(old_transcript, result, grinding_bits));             \
+    }
+
+using keccak_pow_type = zk::commitments::proof_of_work<keccak_type>;
+using poseidon_pow_type = zk::commitments::field_proof_of_work<poseidon_type, field_type>;
+
+POW_BENCHMARK_TEST_CASE(keccak_pow, keccak_pow_type, keccak_type, 16, 10)
+POW_BENCHMARK_TEST_CASE(keccak_pow, keccak_pow_type, keccak_type, 20, 10)
+POW_BENCHMARK_TEST_CASE(poseidon_pow, poseidon_pow_type, poseidon_type, 16, 10)
+POW_BENCHMARK_TEST_CASE(poseidon_pow, poseidon_pow_type, poseidon_type, 20, 10)
+
+BOOST_AUTO_TEST_SUITE_END()
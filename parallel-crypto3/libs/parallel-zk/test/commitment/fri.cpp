@@ -177,4 +177,28 @@ BOOST_AUTO_TEST_CASE(fri_basic_test_polynomial_dfs) {
 }
 
 
+BOOST_AUTO_TEST_CASE(fri_query_index) {
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, 2> fri_type;
+
+    typename fri_type::params_type params(1, 10, 20, 2);
+    const std::size_t domain_size = params.D[0]->size();
+
+    nil::crypto3::random::algebraic_random_device<FieldType> random_device;
+    for (std::size_t i = 0; i < 20; i++) {
+        typename FieldType::value_type challenge = random_device();
+        typename FieldType::value_type x = challenge.pow((FieldType::modulus - 1) / domain_size);
+
+        std::uint64_t x_index = zk::algorithms::get_query_index<fri_type>(challenge, params);
+        BOOST_CHECK(x_index < domain_size);
+        BOOST_CHECK(params.D[0]->get_domain_element(x_index) == x);
+    }
+    BOOST_CHECK_EQUAL(
+        zk::algorithms::get_query_index<fri_type>(FieldType::value_type::zero(), params), domain_size);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
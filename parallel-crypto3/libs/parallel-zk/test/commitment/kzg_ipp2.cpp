@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE kzg_ipp2_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
+
+using namespace nil::crypto3;
+
+// The commitments run all the pairs through one Miller loop, they are checked against the product of
+// separate pairings followed by the final exponentiation.
+template<typename CurveType>
+struct kzg_ipp2_fixture {
+    using curve_type = CurveType;
+    using commitment_type = zk::commitments::kzg_ipp2<curve_type>;
+    using vkey_type = typename commitment_type::vkey_type;
+    using wkey_type = typename commitment_type::wkey_type;
+    using g1_type = typename curve_type::template g1_type<>;
+    using g2_type = typename curve_type::template g2_type<>;
+    using g1_value_type = typename g1_type::value_type;
+    using g2_value_type = typename g2_type::value_type;
+    using gt_value_type = typename commitment_type::gt_value_type;
+
+    static std::vector<g1_value_type> random_g1(std::size_t n) {
+        std::vector<g1_value_type> result(n);
+        for (auto &p : result) {
+            p = algebra::random_element<g1_type>();
+        }
+        return result;
+    }
+
+    static std::vector<g2_value_type> random_g2(std::size_t n) {
+        std::vector<g2_value_type> result(n);
+        for (auto &p : result) {
+            p = algebra::random_element<g2_type>();
+        }
+        return result;
+    }
+
+    template<typename G1Vector, typename G2Vector>
+    static gt_value_type pairings_product(const G1Vector &p, const G2Vector &q) {
+        gt_value_type result = gt_value_type::one();
+        for (std::size_t i = 0; i < p.size(); ++i) {
+            result = result * algebra::pair<curve_type>(p[i], q[i]);
+        }
+        return result;
+    }
+
+    static gt_value_type reduced(const gt_value_type &f) {
+        return *algebra::final_exponentiation<curve_type>(f);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(kzg_ipp2_test_suite)
+
+BOOST_FIXTURE_TEST_CASE(kzg_ipp2_single_test, kzg_ipp2_fixture<algebra::curves::bls12_381>) {
+    for (std::size_t n : {1, 2, 5}) {
+        vkey_type vkey;
+        vkey.a = random_g2(n);
+        vkey.b = random_g2(n);
+        std::vector<g1_value_type> a = random_g1(n);
+
+        auto commitment = commitment_type::single(vkey, a.begin(), a.end());
+
+        BOOST_CHECK_EQUAL(commitment.first, reduced(pairings_product(a, vkey.a)));
+        BOOST_CHECK_EQUAL(commitment.second, reduced(pairings_product(a, vkey.b)));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(kzg_ipp2_pair_test, kzg_ipp2_fixture<algebra::curves::bls12_381>) {
+    for (std::size_t n : {1, 2, 5}) {
+        vkey_type vkey;
+        vkey.a = random_g2(n);
+        vkey.b = random_g2(n);
+        wkey_type wkey;
+        wkey.a = random_g1(n);
+        wkey.b = random_g1(n);
+        std::vector<g1_value_type> a = random_g1(n);
+        std::vector<g2_value_type> b = random_g2(n);
+
+        auto commitment = commitment_type::pair(vkey, wkey, a.begin(), a.end(), b.begin(), b.end());
+
+        BOOST_CHECK_EQUAL(commitment.first, reduced(pairings_product(a, vkey.a) * pairings_product(wkey.a, b)));
+        BOOST_CHECK_EQUAL(commitment.second, reduced(pairings_product(a, vkey.b) * pairings_product(wkey.b, b)));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -39,6 +39,7 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/expression_compiler.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
 
 using namespace nil::crypto3;
@@ -102,6 +103,53 @@ BOOST_AUTO_TEST_CASE(expression_evaluation_test) {
     BOOST_CHECK(evaluator.evaluate() == variable_type::assignment_type((1u + 2u) * (3u + 4u)));
 }
 
+BOOST_AUTO_TEST_CASE(compiled_expression_evaluation_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+    using value_type = variable_type::assignment_type;
+
+    variable_type w0(0, 0, variable_type::column_type::witness);
+    variable_type w1(3, -1, variable_type::column_type::public_input);
+    variable_type w2(4, 1, variable_type::column_type::public_input);
+    variable_type w3(6, 2, variable_type::column_type::constant);
+
+    // Contains repeated subexpressions, constants to fold and a power.
+    expression<variable_type> expr = ((w0 + w1) * (w2 + w3)).pow(3) + w0 * w1 * value_type(5u) +
+        w1 * w0 * value_type(5u) - (w0 + w1) * (w2 + w3) * value_type(2u) * value_type(3u) + value_type(0u) * w2;
+
+    compiled_expression<variable_type> compiled(expr);
+    BOOST_CHECK_EQUAL(compiled.get_variables().size(), 4);
+
+    // More rows than a single block, and not a multiple of the block size.
+    std::size_t rows = compiled_expression<variable_type>::block_size * 2 + 17;
+    std::vector<std::vector<value_type>> columns(compiled.get_variables().size(), std::vector<value_type>(rows));
+    std::vector<const value_type*> column_pointers;
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        for (std::size_t j = 0; j < rows; ++j) {
+            columns[i][j] = value_type(i * rows + j + 1);
+        }
+        column_pointers.push_back(columns[i].data());
+    }
+
+    std::vector<value_type> result(rows);
+    compiled.evaluate(column_pointers, 0, rows, result.data());
+
+    for (std::size_t j = 0; j < rows; ++j) {
+        expression_evaluator<variable_type> evaluator(
+            expr,
+            [&compiled, &columns, j](const variable_type& var) -> const value_type& {
+                const auto& variables = compiled.get_variables();
+                std::size_t index = std::find(variables.begin(), variables.end(), var) - variables.begin();
+                return columns[index][j];
+            }
+        );
+        BOOST_CHECK(evaluator.evaluate() == result[j]);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(expression_max_degree_visitor_test) {
 
     // setup
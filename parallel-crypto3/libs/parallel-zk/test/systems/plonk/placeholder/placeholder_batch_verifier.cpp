@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Batch verification against placeholder_verifier, proof by proof (pallas and poseidon)
+//
+
+#define BOOST_TEST_MODULE placeholder_batch_verifier_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_verifier.hpp>
+
+#include "circuits.hpp"
+#include "placeholder_test_runner.hpp"
+
+// Proves circuit_test_fib once, the tests verify copies of that proof, some of them spoiled.
+struct F {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using value_type = typename field_type::value_type;
+    using hash_type = hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>;
+    using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type>;
+    using placeholder_params_type = typename test_runner_type::lpc_placeholder_params_type;
+    using lpc_scheme_type = typename test_runner_type::lpc_scheme_type;
+    using public_preprocessor_type = placeholder_public_preprocessor<field_type, placeholder_params_type>;
+    using private_preprocessor_type = placeholder_private_preprocessor<field_type, placeholder_params_type>;
+    using verifier_type = placeholder_verifier<field_type, placeholder_params_type>;
+    using batch_verifier_type = placeholder_batch_verifier<field_type, placeholder_params_type>;
+    using proof_type = typename batch_verifier_type::proof_type;
+    using public_input_type = typename batch_verifier_type::public_input_type;
+
+    F() : runner(circuit_test_fib<field_type, 100>())
+        , lpc_scheme(runner.fri_params)
+        , preprocessed_public_data(public_preprocessor_type::process(
+            runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme))
+        , proof(prove())
+        , public_input(runner.assignments.public_inputs().begin(), runner.assignments.public_inputs().end()) {
+    }
+
+    proof_type prove() {
+        auto preprocessed_private_data = private_preprocessor_type::process(
+            runner.constraint_system, runner.assignments.private_table(), runner.desc);
+        return placeholder_prover<field_type, placeholder_params_type>::process(
+            preprocessed_public_data, std::move(preprocessed_private_data), runner.desc, runner.constraint_system,
+            lpc_scheme);
+    }
+
+    batch_verifier_type make_batch_verifier() const {
+        // The prover's commitment scheme must not be reused by the verifier.
+        return batch_verifier_type(preprocessed_public_data.common_data, runner.desc, runner.constraint_system,
+                                   lpc_scheme_type(runner.fri_params));
+    }
+
+    bool verify(const proof_type &p) const {
+        lpc_scheme_type verifier_lpc_scheme(runner.fri_params);
+        return verifier_type::process(preprocessed_public_data.common_data, p, runner.desc, runner.constraint_system,
+                                      verifier_lpc_scheme);
+    }
+
+    bool verify(const proof_type &p, const public_input_type &input) const {
+        lpc_scheme_type verifier_lpc_scheme(runner.fri_params);
+        return verifier_type::process(preprocessed_public_data.common_data, p, runner.desc, runner.constraint_system,
+                                      verifier_lpc_scheme, input);
+    }
+
+    proof_type spoiled_proof() const {
+        proof_type result = proof;
+        result.eval_proof.challenge += value_type::one();
+        return result;
+    }
+
+    test_runner_type runner;
+    lpc_scheme_type lpc_scheme;
+    typename public_preprocessor_type::preprocessed_data_type preprocessed_public_data;
+    proof_type proof;
+    public_input_type public_input;
+};
+
+BOOST_FIXTURE_TEST_SUITE(placeholder_batch_verifier_test_suite, F)
+
+BOOST_AUTO_TEST_CASE(placeholder_batch_verifier_single_proof_test) {
+    batch_verifier_type batch_verifier = make_batch_verifier();
+
+    BOOST_CHECK(verify(proof));
+    BOOST_CHECK(batch_verifier.process(proof));
+    BOOST_CHECK(!verify(spoiled_proof()));
+    BOOST_CHECK(!batch_verifier.process(spoiled_proof()));
+}
+
+BOOST_AUTO_TEST_CASE(placeholder_batch_verifier_invalid_proof_test) {
+    batch_verifier_type batch_verifier = make_batch_verifier();
+
+    std::vector<proof_type> proofs(4, proof);
+    proofs[2] = spoiled_proof();
+
+    std::vector<bool> results = batch_verifier.process(proofs);
+    BOOST_CHECK(results == std::vector<bool>({true, true, false, true}));
+    for (std::size_t i = 0; i < proofs.size(); ++i) {
+        BOOST_CHECK_EQUAL(results[i], verify(proofs[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(placeholder_batch_verifier_public_input_test) {
+    batch_verifier_type batch_verifier = make_batch_verifier();
+
+    public_input_type wrong_public_input = public_input;
+    wrong_public_input[0][0] += value_type::one();
+
+    // A valid proof with the right and the wrong public input, and a spoiled proof with the right one.
+    std::vector<proof_type> proofs = {proof, proof, spoiled_proof(), proof};
+    std::vector<public_input_type> public_inputs = {public_input, wrong_public_input, public_input, public_input};
+
+    std::vector<bool> results = batch_verifier.process(proofs, public_inputs);
+    BOOST_CHECK(results == std::vector<bool>({true, false, false, true}));
+    for (std::size_t i = 0; i < proofs.size(); ++i) {
+        BOOST_CHECK_EQUAL(results[i], verify(proofs[i], public_inputs[i]));
+        BOOST_CHECK_EQUAL(batch_verifier.process(proofs[i], public_inputs[i]), results[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
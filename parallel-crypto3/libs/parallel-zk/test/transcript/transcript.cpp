@@ -25,6 +25,8 @@
 
 #define BOOST_TEST_MODULE zk_transcript_test
 
+#include <array>
+#include <cstdint>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
@@ -121,6 +123,60 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+// The batched challenges grinding uses must match absorbing each input into a copy of the transcript.
+template<typename Field, typename Transcript, typename Input>
+void check_challenges_after_each(const Transcript &tr, const std::vector<Input> &inputs) {
+    std::vector<typename Field::value_type> challenges(inputs.size());
+    std::vector<std::uint32_t> int_challenges(inputs.size());
+    tr.template challenges_after_each<Field>(inputs, challenges.begin());
+    tr.template int_challenges_after_each<std::uint32_t>(inputs, int_challenges.begin());
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        Transcript copy = tr;
+        copy(inputs[i]);
+        Transcript int_copy = copy;
+        BOOST_CHECK_EQUAL(challenges[i].data, copy.template challenge<Field>().data);
+        BOOST_CHECK_EQUAL(int_challenges[i], int_copy.template int_challenge<std::uint32_t>());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(zk_transcript_challenges_after_each_test_suite)
+
+BOOST_AUTO_TEST_CASE(keccak_challenges_after_each_test) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript::fiat_shamir_heuristic_sequential<hashes::keccak_1600<256>> tr(init_blob);
+
+    // Not a multiple of any lane count, so the last group falls back to hashing one message at a time.
+    std::vector<typename field_type::value_type> field_inputs;
+    std::vector<std::array<std::uint8_t, 4>> byte_inputs;
+    for (std::uint8_t i = 0; i < 11; ++i) {
+        field_inputs.push_back(typename field_type::value_type(i + 0x1234567u));
+        byte_inputs.push_back({i, 1, 2, 3});
+    }
+    check_challenges_after_each<field_type>(tr, field_inputs);
+    check_challenges_after_each<field_type>(tr, byte_inputs);
+}
+
+BOOST_AUTO_TEST_CASE(poseidon_challenges_after_each_test) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    std::vector<typename field_type::value_type> inputs;
+    for (std::size_t i = 0; i < 11; ++i) {
+        inputs.push_back(typename field_type::value_type(i + 0x1234567u));
+    }
+
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> tr;
+    check_challenges_after_each<field_type>(tr, inputs);
+    // The sponge is full now, so the next absorb permutes it first.
+    tr(inputs[0]);
+    tr(inputs[1]);
+    check_challenges_after_each<field_type>(tr, inputs);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /* TODO: Write more elaborate tests for transcript of curve elements */
 BOOST_AUTO_TEST_SUITE(transcript_test_curves)
 
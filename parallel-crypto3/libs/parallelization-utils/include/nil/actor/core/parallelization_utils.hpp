@@ -25,15 +25,13 @@
 #ifndef CRYPTO3_PARALLELIZATION_UTILS_HPP
 #define CRYPTO3_PARALLELIZATION_UTILS_HPP
 
-#include <future>
-
 #include <nil/actor/core/thread_pool.hpp>
 
 namespace nil {
     namespace crypto3 {
 
         template<class ReturnType>
-        std::vector<ReturnType> wait_for_all(std::vector<std::future<ReturnType>> futures) {
+        std::vector<ReturnType> wait_for_all(std::vector<task_future<ReturnType>> futures) {
             std::vector<ReturnType> results;
             for (auto& f: futures) {
                 results.push_back(f.get());
@@ -41,22 +39,23 @@ namespace nil {
             return results;
         }
 
-        inline void wait_for_all(std::vector<std::future<void>> futures) {
+        inline void wait_for_all(std::vector<task_future<void>> futures) {
             for (auto& f: futures) {
                 f.get();
             }
         }
 
-        // Divides work into chunks and makes calls to 'func' in parallel.
+        // Divides work into chunks and makes calls to 'func' in parallel. Chunks are pushed to the work-stealing
+        // scheduler, so calling this from inside another parallel task is fine, waiting helps with the work.
         template<class ReturnType>
-        std::vector<std::future<ReturnType>> parallel_run_in_chunks_with_thread_id(
+        std::vector<task_future<ReturnType>> parallel_run_in_chunks_with_thread_id(
                 std::size_t elements_count,
                 std::function<ReturnType(std::size_t thread_id, std::size_t begin, std::size_t end)> func, 
                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
 
             auto& thread_pool = ThreadPool::get_instance(pool_id);
 
-            std::vector<std::future<ReturnType>> fut;
+            std::vector<task_future<ReturnType>> fut;
             std::size_t workers_to_use = std::max((size_t)1, std::min(elements_count, thread_pool.get_pool_size()));
 
             // For pool #0 we have experimentally found that operations over chunks of <4096 elements
@@ -82,7 +81,7 @@ namespace nil {
         }
 
         template<class ReturnType>
-        std::vector<std::future<ReturnType>> parallel_run_in_chunks(
+        std::vector<task_future<ReturnType>> parallel_run_in_chunks(
                 std::size_t elements_count,
                 std::function<ReturnType(std::size_t begin, std::size_t end)> func, 
                 ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
@@ -25,44 +25,164 @@
 #ifndef CRYPTO3_THREAD_POOL_HPP
 #define CRYPTO3_THREAD_POOL_HPP
 
-#include <boost/asio/thread_pool.hpp>
-#include <boost/asio/post.hpp>
-
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
-#include <future>
-#include <thread>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace nil {
     namespace crypto3 {
 
+        class ThreadPool;
+
+        namespace detail {
+
+            // Type-erased unit of work stored in the worker deques.
+            class pool_task_base {
+            public:
+                virtual ~pool_task_base() = default;
+                virtual void run() = 0;
+            };
+
+            // Task together with its completion state, allocated once per posted task.
+            template<class ReturnType>
+            class pool_task : public pool_task_base {
+            public:
+                explicit pool_task(std::function<ReturnType()>&& func)
+                    : func(std::move(func)) {
+                }
+
+                void run() override {
+                    try {
+                        if constexpr (std::is_void_v<ReturnType>) {
+                            func();
+                        } else {
+                            result.emplace(func());
+                        }
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+                    // Release captured state as soon as possible, the task object may live longer
+                    // in the future that references it.
+                    func = nullptr;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done.store(true, std::memory_order_release);
+                    }
+                    cv.notify_all();
+                }
+
+                bool is_done() const {
+                    return done.load(std::memory_order_acquire);
+                }
+
+                std::function<ReturnType()> func;
+                std::conditional_t<std::is_void_v<ReturnType>, bool, std::optional<ReturnType>> result;
+                std::exception_ptr exception;
+                std::atomic<bool> done = false;
+                std::mutex mutex;
+                std::condition_variable cv;
+            };
+
+            // Double-ended queue of a single worker. The owner pushes and pops at the back (LIFO, good
+            // for cache locality of nested fork/join), thieves take from the front (FIFO, the largest
+            // pieces of work are the oldest ones).
+            class work_stealing_deque {
+            public:
+                void push(std::shared_ptr<pool_task_base>&& task) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    tasks.push_back(std::move(task));
+                }
+
+                std::shared_ptr<pool_task_base> pop() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (tasks.empty())
+                        return nullptr;
+                    auto task = std::move(tasks.back());
+                    tasks.pop_back();
+                    return task;
+                }
+
+                std::shared_ptr<pool_task_base> steal() {
+                    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+                    if (!lock.owns_lock() || tasks.empty())
+                        return nullptr;
+                    auto task = std::move(tasks.front());
+                    tasks.pop_front();
+                    return task;
+                }
+
+            private:
+                std::mutex mutex;
+                std::deque<std::shared_ptr<pool_task_base>> tasks;
+            };
+
+        }    // namespace detail
+
+        /** Result of a task posted to the ThreadPool. Unlike std::future, waiting on it from inside the pool
+         *  does not block the worker: while the task is not finished, the waiting thread executes other
+         *  pending tasks. This makes nested parallel calls safe regardless of the pool level used.
+         */
+        template<class ReturnType>
+        class task_future {
+        public:
+            task_future() = default;
+
+            task_future(ThreadPool* pool, std::shared_ptr<detail::pool_task<ReturnType>> task)
+                : pool(pool)
+                , task(std::move(task)) {
+            }
+
+            bool valid() const {
+                return task != nullptr;
+            }
+
+            bool is_ready() const {
+                return task->is_done();
+            }
+
+            // Waits for the task, helping with the pending work meanwhile. Rethrows the exception of the task, if any.
+            ReturnType get();
+
+        private:
+            ThreadPool* pool = nullptr;
+            std::shared_ptr<detail::pool_task<ReturnType>> task;
+        };
+
+        /** Work-stealing scheduler with fork/join semantics. There is a single set of workers, each one owns
+         *  a deque of tasks. Tasks posted from a worker go to its own deque, tasks posted from outside go to
+         *  a shared injection queue, idle workers steal from the others.
+         */
         class ThreadPool {
         public:
 
+            /** Pool levels are kept as a hint for the chunking heuristics in parallel_run_in_chunks. All the
+             *  levels are served by the same set of workers, a task waiting for the results of lower level
+             *  tasks executes pending work instead of blocking, so mixing levels can not deadlock.
+             */
             enum class PoolLevel {
                 LOW,
                 HIGH,
                 LASTPOOL
             };
 
-            /** Returns a thread pool, based on the pool_id. pool with LOW is normally used for low-level operations, like polynomial
-             *  operations and fft. Any code that uses these operations and needs to be parallel will submit its tasks to pool with HIGH.
-             *  Submission of higher level tasks to low level pool will immediately result in a deadlock.
-             */
             static ThreadPool& get_instance(PoolLevel pool_id, std::size_t pool_size = std::thread::hardware_concurrency()) {
-                static ThreadPool instance_for_low_level(pool_size);
-                static ThreadPool instance_for_middle_level(pool_size);
-                static ThreadPool instance_for_high_level(pool_size);
-                
-                if (pool_id == PoolLevel::LOW)
-                    return instance_for_low_level;
-                if (pool_id == PoolLevel::HIGH)
-                    return instance_for_middle_level;
-                if (pool_id == PoolLevel::LASTPOOL)
-                    return instance_for_high_level;
+                static ThreadPool instance(pool_size);
+
+                if (pool_id == PoolLevel::LOW || pool_id == PoolLevel::HIGH || pool_id == PoolLevel::LASTPOOL)
+                    return instance;
 
                 throw std::invalid_argument("Invalid instance of thread pool requested.");
             }
@@ -70,34 +190,179 @@ namespace nil {
             ThreadPool(const ThreadPool& obj)= delete;
             ThreadPool& operator=(const ThreadPool& obj)= delete;
 
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                    stopping = true;
+                }
+                sleep_cv.notify_all();
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
             template<class ReturnType>
-            inline std::future<ReturnType> post(std::function<ReturnType()> task) {
-                auto packaged_task = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
-                std::future<ReturnType> fut = packaged_task->get_future();
-                boost::asio::post(pool, [packaged_task]() -> void { (*packaged_task)(); });
+            inline task_future<ReturnType> post(std::function<ReturnType()> task) {
+                auto pool_task = std::make_shared<detail::pool_task<ReturnType>>(std::move(task));
+                task_future<ReturnType> fut(this, pool_task);
+                submit(std::move(pool_task));
                 return fut;
             }
- 
-            // Waits for all the tasks to complete.
+
+            // Waits for all the tasks to complete, helping to execute them.
             inline void join() {
-                pool.join();
+                while (pending_tasks.load(std::memory_order_acquire) != 0 ||
+                       running_tasks.load(std::memory_order_acquire) != 0) {
+                    if (!try_run_one()) {
+                        std::this_thread::yield();
+                    }
+                }
             }
 
             std::size_t get_pool_size() const {
                 return pool_size;
             }
 
+            // Executes a single pending task on the calling thread. Returns false if no task was found.
+            bool try_run_one() {
+                std::shared_ptr<detail::pool_task_base> task = take_task();
+                if (!task)
+                    return false;
+                running_tasks.fetch_add(1, std::memory_order_acq_rel);
+                pending_tasks.fetch_sub(1, std::memory_order_acq_rel);
+                task->run();
+                running_tasks.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+
         private:
             inline ThreadPool(std::size_t pool_size)
-                : pool(pool_size)
-                , pool_size(pool_size)  {
+                : pool_size(std::max(std::size_t(1), pool_size))
+                , deques(this->pool_size) {
+                workers.reserve(this->pool_size);
+                for (std::size_t i = 0; i < this->pool_size; ++i) {
+                    workers.emplace_back([this, i]() { worker_loop(i); });
+                }
+            }
+
+            // Index of the worker of this pool running on the current thread, or pool_size for foreign threads.
+            std::size_t current_worker_index() const {
+                return current_pool() == this ? current_index() : pool_size;
+            }
+
+            static const ThreadPool*& current_pool() {
+                static thread_local const ThreadPool* pool = nullptr;
+                return pool;
+            }
+
+            static std::size_t& current_index() {
+                static thread_local std::size_t index = 0;
+                return index;
+            }
+
+            void submit(std::shared_ptr<detail::pool_task_base>&& task) {
+                pending_tasks.fetch_add(1, std::memory_order_acq_rel);
+                std::size_t index = current_worker_index();
+                if (index < pool_size) {
+                    deques[index].push(std::move(task));
+                } else {
+                    std::lock_guard<std::mutex> lock(injection_mutex);
+                    injection_queue.push_back(std::move(task));
+                }
+                // Taking the lock orders the notification after the check of a worker that is about to sleep.
+                { std::lock_guard<std::mutex> lock(sleep_mutex); }
+                sleep_cv.notify_one();
+            }
+
+            std::shared_ptr<detail::pool_task_base> take_task() {
+                std::size_t index = current_worker_index();
+                if (index < pool_size) {
+                    if (auto task = deques[index].pop())
+                        return task;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(injection_mutex);
+                    if (!injection_queue.empty()) {
+                        auto task = std::move(injection_queue.front());
+                        injection_queue.pop_front();
+                        return task;
+                    }
+                }
+                std::size_t start = (index < pool_size) ? index + 1 : 0;
+                for (std::size_t i = 0; i < pool_size; ++i) {
+                    std::size_t victim = (start + i) % pool_size;
+                    if (victim == index)
+                        continue;
+                    if (auto task = deques[victim].steal())
+                        return task;
+                }
+                return nullptr;
+            }
+
+            void worker_loop(std::size_t index) {
+                current_pool() = this;
+                current_index() = index;
+                while (true) {
+                    if (try_run_one())
+                        continue;
+                    std::unique_lock<std::mutex> lock(sleep_mutex);
+                    if (stopping)
+                        return;
+                    if (pending_tasks.load(std::memory_order_acquire) != 0) {
+                        // Some task is queued, but we lost the race for it or its deque was locked, retry.
+                        lock.unlock();
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    sleep_cv.wait(lock, [this]() {
+                        return stopping || pending_tasks.load(std::memory_order_acquire) != 0;
+                    });
+                }
+            }
+
+            template<class ReturnType>
+            friend class task_future;
+
+            // Called by a waiting future, runs pending work until the given task is done.
+            template<class ReturnType>
+            void help_until_done(detail::pool_task<ReturnType>& task) {
+                while (!task.is_done()) {
+                    if (try_run_one())
+                        continue;
+                    // Nothing to run, the task is being executed by someone else. Sleep until it completes,
+                    // waking up periodically to check for newly arrived work.
+                    std::unique_lock<std::mutex> lock(task.mutex);
+                    task.cv.wait_for(lock, std::chrono::microseconds(100), [&task]() { return task.is_done(); });
+                }
             }
 
-            boost::asio::thread_pool pool;
             const std::size_t pool_size;
+            std::vector<detail::work_stealing_deque> deques;
+            std::vector<std::thread> workers;
 
+            std::mutex injection_mutex;
+            std::deque<std::shared_ptr<detail::pool_task_base>> injection_queue;
+
+            std::atomic<std::size_t> pending_tasks = 0;
+            std::atomic<std::size_t> running_tasks = 0;
+            std::mutex sleep_mutex;
+            std::condition_variable sleep_cv;
+            bool stopping = false;
         };
 
+        template<class ReturnType>
+        ReturnType task_future<ReturnType>::get() {
+            if (!task)
+                throw std::logic_error("Waiting on an empty task_future.");
+            pool->help_until_done(*task);
+            auto finished = std::move(task);
+            if (finished->exception)
+                std::rethrow_exception(finished->exception);
+            if constexpr (!std::is_void_v<ReturnType>) {
+                return std::move(*finished->result);
+            }
+        }
+
     }        // namespace crypto3
 }    // namespace nil
 
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <stdexcept>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -61,4 +62,57 @@ BOOST_AUTO_TEST_CASE(vector_multiplication_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(nested_parallel_for_test) {
+    std::size_t outer_size = 64;
+    std::size_t inner_size = 1 << 14;
+
+    std::vector<std::vector<std::size_t>> v(outer_size, std::vector<std::size_t>(inner_size));
+
+    // Inner calls wait on the lower level inside the tasks of the upper level, with any combination
+    // of levels. Waiting tasks execute the pending work, so this must neither deadlock nor lose work.
+    nil::crypto3::parallel_for(0, outer_size,
+        [&v, inner_size](std::size_t i) {
+            nil::crypto3::parallel_for(0, inner_size,
+                [&v, i](std::size_t j) {
+                    v[i][j] = i * j;
+                }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+        }, nil::crypto3::ThreadPool::PoolLevel::LOW);
+
+    for (std::size_t i = 0; i < outer_size; ++i) {
+        for (std::size_t j = 0; j < inner_size; ++j) {
+            BOOST_CHECK_EQUAL(v[i][j], i * j);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(return_values_test) {
+    std::size_t size = 1 << 16;
+
+    auto sums = nil::crypto3::wait_for_all(nil::crypto3::parallel_run_in_chunks<std::size_t>(
+        size,
+        [](std::size_t begin, std::size_t end) {
+            std::size_t sum = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                sum += i;
+            }
+            return sum;
+        }, nil::crypto3::ThreadPool::PoolLevel::HIGH));
+
+    std::size_t total = 0;
+    for (auto s : sums) {
+        total += s;
+    }
+    BOOST_CHECK_EQUAL(total, size * (size - 1) / 2);
+}
+
+BOOST_AUTO_TEST_CASE(exception_propagation_test) {
+    BOOST_CHECK_THROW(
+        nil::crypto3::parallel_for(0, 1024,
+            [](std::size_t i) {
+                if (i == 1000)
+                    throw std::runtime_error("task failure");
+            }, nil::crypto3::ThreadPool::PoolLevel::HIGH),
+        std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_AGGREGATED_PROVER_HPP
+#define PROOF_GENERATOR_AGGREGATED_PROVER_HPP
+
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/proof-generator/assignment_table_file.hpp>
+#include <nil/proof-generator/prover.hpp>
+
+namespace nil {
+    namespace proof_generator {
+        /*
+         * Runs the whole aggregated proving flow for several circuits in a single process: partial proofs,
+         * aggregated challenge, combined Q polynomials, aggregated FRI proof, consistency checks and the merged
+         * proof. It is the same flow as the stages generate-partial-proof ... merge-proofs run one after another,
+         * but challenges and polynomials are passed in memory. The work of different circuits is done in parallel.
+         */
+        template<typename CurveType, typename HashType>
+        class AggregatedProver {
+        public:
+            using ProverType = Prover<CurveType, HashType>;
+            using BlueprintField = typename ProverType::BlueprintField;
+            using Proof = typename ProverType::Proof;
+            using AggregatedProof = typename ProverType::AggregatedProof;
+            using LpcScheme = typename ProverType::LpcScheme;
+            using polynomial_type = typename ProverType::polynomial_type;
+
+            AggregatedProver(
+                std::size_t lambda,
+                std::size_t expand_factor,
+                std::size_t max_q_chunks,
+                std::size_t grind,
+                std::string circuit_name
+            ) : lambda_(lambda),
+                expand_factor_(expand_factor),
+                max_quotient_chunks_(max_q_chunks),
+                grind_(grind),
+                circuit_name_(circuit_name) {
+            }
+
+            bool generate_to_file(
+                const std::vector<boost::filesystem::path>& circuit_files,
+                const std::vector<boost::filesystem::path>& assignment_table_files,
+                const boost::filesystem::path& merged_proof_file
+            ) {
+                if (circuit_files.empty() || circuit_files.size() != assignment_table_files.size()) {
+                    BOOST_LOG_TRIVIAL(error) << "Number of circuits and assignment tables should match and be non-zero.";
+                    return false;
+                }
+                const std::size_t provers_amount = circuit_files.size();
+                provers_.clear();
+                provers_.resize(provers_amount);
+
+                std::vector<std::optional<Proof>> partial_proofs(provers_amount);
+                bool ok = for_each_prover([&](std::size_t i) {
+                    ProverType& prover = provers_[i].emplace(
+                        lambda_, expand_factor_, max_quotient_chunks_, grind_, circuit_name_);
+                    if (!prover.read_circuit(circuit_files[i]) ||
+                            !prover.read_assignment_table(assignment_table_files[i]) ||
+                            !prover.preprocess_public_data() ||
+                            !prover.preprocess_private_data()) {
+                        return false;
+                    }
+                    partial_proofs[i].emplace(prover.generate_partial_proof());
+                    return true;
+                });
+                if (!ok) {
+                    BOOST_LOG_TRIVIAL(error) << "Partial proof generation failed";
+                    return false;
+                }
+
+                std::vector<typename BlueprintField::value_type> challenges;
+                for (const auto& partial_proof : partial_proofs) {
+                    challenges.push_back(partial_proof->eval_proof.challenge);
+                }
+                const typename BlueprintField::value_type aggregated_challenge =
+                    ProverType::aggregate_challenges(challenges);
+
+                // Each prover continues the powers of theta where the previous one stopped.
+                std::vector<std::size_t> starting_powers(provers_amount);
+                std::size_t theta_power = 0;
+                for (std::size_t i = 0; i < provers_amount; ++i) {
+                    starting_powers[i] = theta_power;
+                    theta_power += provers_[i]->compute_theta_power_for_combined_Q();
+                }
+
+                std::vector<polynomial_type> combined_Q(provers_amount);
+                ok = for_each_prover([&](std::size_t i) {
+                    combined_Q[i] = provers_[i]->compute_combined_Q(aggregated_challenge, starting_powers[i]);
+                    return true;
+                });
+                if (!ok) {
+                    BOOST_LOG_TRIVIAL(error) << "Combined Q computation failed";
+                    return false;
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Generating aggregated FRI proof";
+                polynomial_type sum_poly;
+                for (const auto& poly : combined_Q) {
+                    sum_poly += poly;
+                }
+                auto aggregated_fri_proof = provers_[0]->generate_aggregated_FRI_proof(aggregated_challenge, sum_poly);
+
+                AggregatedProof merged_proof;
+                merged_proof.aggregated_proof.initial_proofs_per_prover.resize(provers_amount);
+                ok = for_each_prover([&](std::size_t i) {
+                    merged_proof.aggregated_proof.initial_proofs_per_prover[i] =
+                        provers_[i]->generate_consistency_checks(combined_Q[i], aggregated_fri_proof.challenges);
+                    return true;
+                });
+                if (!ok) {
+                    BOOST_LOG_TRIVIAL(error) << "Consistency checks generation failed";
+                    return false;
+                }
+                for (auto& partial_proof : partial_proofs) {
+                    merged_proof.partial_proofs.emplace_back(std::move(*partial_proof));
+                }
+                merged_proof.aggregated_proof.fri_proof = std::move(aggregated_fri_proof.fri_proof);
+
+                return provers_[0]->save_aggregated_proof_to_file(
+                    merged_proof, provers_[0]->make_fri_params(), merged_proof_file);
+            }
+
+        private:
+            // Exceptions do not cross the worker threads, they fail the step.
+            template<typename Function>
+            bool for_each_prover(Function f) {
+                return detail::run_for_each_in_parallel(provers_.size(), [&f](std::size_t i) {
+                    try {
+                        return f(i);
+                    } catch (const std::exception& e) {
+                        BOOST_LOG_TRIVIAL(error) << "Prover " << i << ": " << e.what();
+                        return false;
+                    }
+                });
+            }
+
+            const std::size_t lambda_;
+            const std::size_t expand_factor_;
+            const std::size_t max_quotient_chunks_;
+            const std::size_t grind_;
+            const std::string circuit_name_;
+
+            std::vector<std::optional<ProverType>> provers_;
+        };
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_AGGREGATED_PROVER_HPP
@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_ASSIGNMENT_TABLE_FILE_HPP
+#define PROOF_GENERATOR_ASSIGNMENT_TABLE_FILE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+
+#include <nil/blueprint/utils/parallel_for.hpp>
+
+#include <nil/proof-generator/binary_container.hpp>
+
+namespace nil {
+    namespace proof_generator {
+        namespace assignment_table_file {
+            constexpr std::uint32_t content_type = 2;
+            constexpr std::uint32_t content_version = 1;
+
+            enum section_kind : std::uint32_t {
+                // Witness, public input, constant and selector columns amounts, usable rows and rows amounts.
+                description = 1,
+                // Values of a single column, the key is the column index. Columns are not padded with zeroes
+                // up to the rows amount in the file, the reader pads them.
+                witness_column = 2,
+                public_input_column = 3,
+                constant_column = 4,
+                selector_column = 5,
+            };
+
+            constexpr std::size_t description_size = 6;
+        } // namespace assignment_table_file
+
+        namespace detail {
+            // Runs f(i) for all i in [0, amount) on all hardware threads, returns false if any of the calls did.
+            template<typename Function>
+            bool run_for_each_in_parallel(std::size_t amount, Function f) {
+                std::atomic<bool> ok(true);
+                nil::blueprint::parallel_for(amount, [&](std::size_t i) {
+                    if (ok && !f(i)) {
+                        ok = false;
+                    }
+                });
+                return ok;
+            }
+
+            struct assignment_column_location {
+                assignment_table_file::section_kind kind;
+                std::size_t index;
+            };
+
+            template<typename BlueprintField>
+            std::vector<assignment_column_location> assignment_table_columns(
+                const nil::crypto3::zk::snark::plonk_table_description<BlueprintField>& desc
+            ) {
+                std::vector<assignment_column_location> columns;
+                const std::array<std::pair<assignment_table_file::section_kind, std::size_t>, 4> kinds = {{
+                    {assignment_table_file::witness_column, desc.witness_columns},
+                    {assignment_table_file::public_input_column, desc.public_input_columns},
+                    {assignment_table_file::constant_column, desc.constant_columns},
+                    {assignment_table_file::selector_column, desc.selector_columns},
+                }};
+                for (const auto& [kind, amount] : kinds) {
+                    for (std::size_t i = 0; i < amount; ++i) {
+                        columns.push_back({kind, i});
+                    }
+                }
+                return columns;
+            }
+
+            template<typename AssignmentTable>
+            const auto& assignment_table_column(
+                const AssignmentTable& table,
+                const assignment_column_location& column
+            ) {
+                switch (column.kind) {
+                    case assignment_table_file::witness_column:
+                        return table.witness(column.index);
+                    case assignment_table_file::public_input_column:
+                        return table.public_input(column.index);
+                    case assignment_table_file::constant_column:
+                        return table.constant(column.index);
+                    default:
+                        return table.selector(column.index);
+                }
+            }
+        } // namespace detail
+
+        /*
+         * Writes the assignment table column by column in a binary container, values are stored in their in-memory
+         * representation. Columns are written in parallel. rows_amount is the number of rows the table is padded to.
+         */
+        template<typename BlueprintField>
+        bool write_assignment_table_file(
+            const boost::filesystem::path& path,
+            const nil::crypto3::zk::snark::plonk_assignment_table<BlueprintField>& table,
+            const nil::crypto3::zk::snark::plonk_table_description<BlueprintField>& desc,
+            std::size_t rows_amount
+        ) {
+            using value_type = typename BlueprintField::value_type;
+
+            nil::crypto3::zk::snark::plonk_table_description<BlueprintField> written_desc(
+                table.witnesses_amount(), table.public_inputs_amount(), table.constants_amount(),
+                table.selectors_amount(), desc.usable_rows_amount, rows_amount);
+            const std::vector<detail::assignment_column_location> columns =
+                detail::assignment_table_columns(written_desc);
+
+            std::vector<binary_container_section> sections(columns.size() + 1);
+            sections[0].kind = assignment_table_file::description;
+            sections[0].element_size = sizeof(std::uint64_t);
+            sections[0].size = assignment_table_file::description_size * sizeof(std::uint64_t);
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                const std::size_t column_size =
+                    std::min(detail::assignment_table_column(table, columns[i]).size(), rows_amount);
+                sections[i + 1].kind = columns[i].kind;
+                sections[i + 1].key = columns[i].index;
+                sections[i + 1].element_size = sizeof(value_type);
+                sections[i + 1].size = column_size * sizeof(value_type);
+            }
+
+            preallocated_binary_container_writer writer(
+                path, assignment_table_file::content_type, assignment_table_file::content_version,
+                std::move(sections));
+            if (!writer.is_open()) {
+                BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                return false;
+            }
+
+            const std::array<std::uint64_t, assignment_table_file::description_size> description = {
+                written_desc.witness_columns, written_desc.public_input_columns, written_desc.constant_columns,
+                written_desc.selector_columns, written_desc.usable_rows_amount, written_desc.rows_amount};
+            bool ok = writer.write_section(0, description.data());
+            ok = ok && detail::run_for_each_in_parallel(columns.size(), [&](std::size_t i) {
+                return writer.write_section(i + 1, detail::assignment_table_column(table, columns[i]).data());
+            });
+            ok = writer.close() && ok;
+            return ok;
+        }
+
+        /*
+         * Reads an assignment table written by write_assignment_table_file. The file is mapped, and the columns are
+         * checked and copied into the table in parallel.
+         */
+        template<typename BlueprintField>
+        std::optional<std::pair<
+            nil::crypto3::zk::snark::plonk_table_description<BlueprintField>,
+            nil::crypto3::zk::snark::plonk_assignment_table<BlueprintField>>>
+        read_assignment_table_file(const boost::filesystem::path& path) {
+            using value_type = typename BlueprintField::value_type;
+            using column_type = nil::crypto3::zk::snark::plonk_column<BlueprintField>;
+            using table_type = nil::crypto3::zk::snark::plonk_assignment_table<BlueprintField>;
+            using description_type = nil::crypto3::zk::snark::plonk_table_description<BlueprintField>;
+
+            // Checksums of the columns are verified below, together with copying.
+            auto container = mapped_binary_container::open(
+                path, assignment_table_file::content_type, assignment_table_file::content_version, false);
+            if (!container) {
+                return std::nullopt;
+            }
+
+            const binary_container_section* description_section =
+                container->find_section(assignment_table_file::description, 0);
+            if (description_section == nullptr || !container->verify_section(*description_section)) {
+                BOOST_LOG_TRIVIAL(error) << path << ": assignment table description is missing or corrupted";
+                return std::nullopt;
+            }
+            auto description = container->section_array<std::uint64_t>(*description_section);
+            if (!description || description->size() != assignment_table_file::description_size) {
+                BOOST_LOG_TRIVIAL(error) << path << ": wrong assignment table description size";
+                return std::nullopt;
+            }
+            description_type desc(
+                (*description)[0], (*description)[1], (*description)[2], (*description)[3],
+                (*description)[4], (*description)[5]);
+            if (desc.usable_rows_amount >= desc.rows_amount) {
+                BOOST_LOG_TRIVIAL(error) << path << ": rows amount should be greater than usable rows amount. "
+                    << "Rows amount = " << desc.rows_amount << ", usable rows amount = " << desc.usable_rows_amount;
+                return std::nullopt;
+            }
+
+            const std::vector<detail::assignment_column_location> locations = detail::assignment_table_columns(desc);
+            std::vector<const binary_container_section*> sections(locations.size());
+            for (std::size_t i = 0; i < locations.size(); ++i) {
+                sections[i] = container->find_section(locations[i].kind, locations[i].index);
+                if (sections[i] == nullptr || sections[i]->element_size != sizeof(value_type) ||
+                        sections[i]->size / sizeof(value_type) > desc.rows_amount) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": column " << locations[i].index << " of kind "
+                        << locations[i].kind << " is missing or does not match the description";
+                    return std::nullopt;
+                }
+            }
+
+            std::vector<column_type> columns(locations.size());
+            const bool ok = detail::run_for_each_in_parallel(locations.size(), [&](std::size_t i) {
+                if (!container->verify_section(*sections[i])) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": column " << locations[i].index << " of kind "
+                        << locations[i].kind << " checksum does not match";
+                    return false;
+                }
+                auto values = container->section_array<value_type>(*sections[i]);
+                columns[i].reserve(desc.rows_amount);
+                columns[i].assign(values->begin(), values->end());
+                columns[i].resize(desc.rows_amount, value_type::zero());
+                return true;
+            });
+            if (!ok) {
+                return std::nullopt;
+            }
+
+            auto next_columns = [&columns, it = columns.begin()](std::size_t amount) mutable {
+                std::vector<column_type> result(std::make_move_iterator(it), std::make_move_iterator(it + amount));
+                it += amount;
+                return result;
+            };
+            auto witnesses = next_columns(desc.witness_columns);
+            auto public_inputs = next_columns(desc.public_input_columns);
+            auto constants = next_columns(desc.constant_columns);
+            auto selectors = next_columns(desc.selector_columns);
+
+            return std::make_pair(desc, table_type(
+                std::make_shared<typename table_type::private_table_type>(std::move(witnesses)),
+                std::make_shared<typename table_type::public_table_type>(
+                    std::move(public_inputs), std::move(constants), std::move(selectors))));
+        }
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_ASSIGNMENT_TABLE_FILE_HPP
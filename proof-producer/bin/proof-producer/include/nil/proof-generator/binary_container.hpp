@@ -0,0 +1,527 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_BINARY_CONTAINER_HPP
+#define PROOF_GENERATOR_BINARY_CONTAINER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/assert.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+namespace nil {
+    namespace proof_generator {
+
+        /*
+         * A file made of sections of raw data which can be memory-mapped and used in place, without decoding.
+         *
+         * Layout: header, the sections, each one starting at a multiple of binary_container_alignment,
+         * then the section table. All the integers are in the native byte order, sections keep values
+         * exactly as they are laid out in memory, so a file can be read only on a machine of the same
+         * architecture with the same build of the field types. The magic, the content type and version,
+         * and the element size stored for each section are checked on open to catch the mismatches.
+         */
+        constexpr std::size_t binary_container_alignment = 64;
+        constexpr std::uint32_t binary_container_version = 1;
+
+        struct binary_container_header {
+            char magic[8];
+            std::uint32_t container_version;
+            // What the file holds, e.g. a commitment scheme state, and the version of that layout.
+            std::uint32_t content_type;
+            std::uint32_t content_version;
+            std::uint32_t sections_amount;
+            std::uint64_t table_offset;
+            std::uint64_t table_checksum;
+        };
+
+        struct binary_container_section {
+            std::uint32_t kind;
+            // Size of a single element in bytes, 1 for opaque blobs.
+            std::uint32_t element_size;
+            std::uint64_t key;
+            std::uint64_t offset;
+            std::uint64_t size;
+            std::uint64_t checksum;
+        };
+
+        namespace detail {
+            constexpr char binary_container_magic[8] = {'N', 'I', 'L', 'B', 'I', 'N', 'C', '\0'};
+
+            // Fast non-cryptographic checksum of a byte stream, processes 8 bytes at a time. It only guards
+            // against truncated and corrupted files.
+            class checksum64 {
+            public:
+                void update(const void* data, std::size_t size) {
+                    const auto* bytes = static_cast<const std::uint8_t*>(data);
+                    while (size > 0 && pending_bytes != 0) {
+                        push_byte(*bytes++);
+                        --size;
+                    }
+                    for (; size >= 8; size -= 8, bytes += 8) {
+                        std::uint64_t word;
+                        std::memcpy(&word, bytes, 8);
+                        mix(word);
+                    }
+                    while (size-- > 0) {
+                        push_byte(*bytes++);
+                    }
+                }
+
+                std::uint64_t value() const {
+                    std::uint64_t h = state;
+                    if (pending_bytes != 0) {
+                        h = round(h, pending ^ (std::uint64_t(pending_bytes) << 56));
+                    }
+                    h ^= length;
+                    h ^= h >> 33;
+                    h *= 0xff51afd7ed558ccdULL;
+                    h ^= h >> 33;
+                    return h;
+                }
+
+            private:
+                static std::uint64_t round(std::uint64_t h, std::uint64_t word) {
+                    h ^= word * 0x87c37b91114253d5ULL;
+                    h = (h << 31) | (h >> 33);
+                    return h * 0x4cf5ad432745937fULL;
+                }
+
+                void mix(std::uint64_t word) {
+                    state = round(state, word);
+                    length += 8;
+                }
+
+                void push_byte(std::uint8_t byte) {
+                    pending |= std::uint64_t(byte) << (8 * pending_bytes);
+                    if (++pending_bytes == 8) {
+                        mix(pending);
+                        pending = 0;
+                        pending_bytes = 0;
+                    }
+                }
+
+                std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+                std::uint64_t length = 0;
+                std::uint64_t pending = 0;
+                std::size_t pending_bytes = 0;
+            };
+
+            inline std::uint64_t checksum(const void* data, std::size_t size) {
+                checksum64 sum;
+                sum.update(data, size);
+                return sum.value();
+            }
+
+            inline binary_container_header make_binary_container_header(
+                std::uint32_t content_type,
+                std::uint32_t content_version,
+                const std::vector<binary_container_section>& sections,
+                std::uint64_t table_offset
+            ) {
+                binary_container_header header{};
+                std::memcpy(header.magic, binary_container_magic, sizeof(header.magic));
+                header.container_version = binary_container_version;
+                header.content_type = content_type;
+                header.content_version = content_version;
+                header.sections_amount = static_cast<std::uint32_t>(sections.size());
+                header.table_offset = table_offset;
+                header.table_checksum = checksum(sections.data(), sections.size() * sizeof(binary_container_section));
+                return header;
+            }
+
+            inline std::uint64_t align_offset(std::uint64_t offset) {
+                return (offset + binary_container_alignment - 1) / binary_container_alignment *
+                       binary_container_alignment;
+            }
+        } // namespace detail
+
+        // Read-only view of an array of values inside a mapped file.
+        template<typename T>
+        class array_view {
+        public:
+            array_view() : data_(nullptr), size_(0) {}
+            array_view(const T* data, std::size_t size) : data_(data), size_(size) {}
+
+            const T* begin() const { return data_; }
+            const T* end() const { return data_ + size_; }
+            const T* data() const { return data_; }
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            const T& operator[](std::size_t i) const { return data_[i]; }
+
+        private:
+            const T* data_;
+            std::size_t size_;
+        };
+
+        // Writes the sections one after another. The contents of a section may be passed in several write calls.
+        class binary_container_writer {
+        public:
+            binary_container_writer(
+                const boost::filesystem::path& path,
+                std::uint32_t content_type,
+                std::uint32_t content_version
+            ) : out_(path.c_str(), std::ios::binary | std::ios::out | std::ios::trunc),
+                content_type_(content_type),
+                content_version_(content_version),
+                position_(sizeof(binary_container_header)),
+                in_section_(false) {
+                // The header is written in close(), once the table offset is known.
+                out_.seekp(position_);
+            }
+
+            bool is_open() const {
+                return out_.is_open();
+            }
+
+            void begin_section(std::uint32_t kind, std::uint64_t key, std::uint32_t element_size) {
+                BOOST_ASSERT(!in_section_);
+                binary_container_section section{};
+                section.kind = kind;
+                section.element_size = element_size;
+                section.key = key;
+                sections_.push_back(section);
+                checksum_ = detail::checksum64();
+                in_section_ = true;
+                pad();
+                sections_.back().offset = position_;
+            }
+
+            void write(const void* data, std::size_t size) {
+                BOOST_ASSERT(in_section_);
+                out_.write(static_cast<const char*>(data), size);
+                checksum_.update(data, size);
+                position_ += size;
+                sections_.back().size += size;
+            }
+
+            template<typename T>
+            void write_array(const T* data, std::size_t count) {
+                BOOST_ASSERT(sections_.back().element_size == sizeof(T));
+                write(data, count * sizeof(T));
+            }
+
+            void end_section() {
+                BOOST_ASSERT(in_section_);
+                sections_.back().checksum = checksum_.value();
+                in_section_ = false;
+            }
+
+            bool close() {
+                BOOST_ASSERT(!in_section_);
+                const binary_container_header header = detail::make_binary_container_header(
+                    content_type_, content_version_, sections_, position_);
+
+                out_.write(reinterpret_cast<const char*>(sections_.data()),
+                           sections_.size() * sizeof(binary_container_section));
+                out_.seekp(0);
+                out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out_.close();
+                if (out_.fail()) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to write a binary container";
+                    return false;
+                }
+                return true;
+            }
+
+        private:
+            void pad() {
+                static const char zeros[binary_container_alignment] = {};
+                const std::size_t aligned = detail::align_offset(position_);
+                out_.write(zeros, aligned - position_);
+                position_ = aligned;
+            }
+
+            std::ofstream out_;
+            std::uint32_t content_type_;
+            std::uint32_t content_version_;
+            std::size_t position_;
+            bool in_section_;
+            std::vector<binary_container_section> sections_;
+            detail::checksum64 checksum_;
+        };
+
+        /*
+         * Writes a container whose section sizes are known in advance, so that every section can be placed
+         * before any data is written. Different sections may then be written from different threads at once,
+         * each one in a single write_section call.
+         */
+        class preallocated_binary_container_writer {
+        public:
+            // Only kind, key, element_size and size of the sections are used.
+            preallocated_binary_container_writer(
+                const boost::filesystem::path& path,
+                std::uint32_t content_type,
+                std::uint32_t content_version,
+                std::vector<binary_container_section> sections
+            ) : content_type_(content_type),
+                content_version_(content_version),
+                sections_(std::move(sections)) {
+                std::uint64_t position = sizeof(binary_container_header);
+                for (binary_container_section& section : sections_) {
+                    section.offset = detail::align_offset(position);
+                    section.checksum = 0;
+                    position = section.offset + section.size;
+                }
+                table_offset_ = position;
+
+                fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                const std::uint64_t file_size = table_offset_ + sections_.size() * sizeof(binary_container_section);
+                if (fd_ >= 0 && ::ftruncate(fd_, file_size) != 0) {
+                    ::close(fd_);
+                    fd_ = -1;
+                }
+            }
+
+            preallocated_binary_container_writer(const preallocated_binary_container_writer&) = delete;
+            preallocated_binary_container_writer& operator=(const preallocated_binary_container_writer&) = delete;
+
+            ~preallocated_binary_container_writer() {
+                if (fd_ >= 0) {
+                    ::close(fd_);
+                }
+            }
+
+            bool is_open() const {
+                return fd_ >= 0;
+            }
+
+            const std::vector<binary_container_section>& sections() const {
+                return sections_;
+            }
+
+            // Writes sections()[index].size bytes of data.
+            bool write_section(std::size_t index, const void* data) {
+                binary_container_section& section = sections_[index];
+                section.checksum = detail::checksum(data, section.size);
+                return write_at(data, section.size, section.offset);
+            }
+
+            bool close() {
+                const binary_container_header header = detail::make_binary_container_header(
+                    content_type_, content_version_, sections_, table_offset_);
+                bool ok = write_at(sections_.data(), sections_.size() * sizeof(binary_container_section), table_offset_) &&
+                          write_at(&header, sizeof(header), 0);
+                ok = ::close(fd_) == 0 && ok;
+                fd_ = -1;
+                if (!ok) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to write a binary container";
+                }
+                return ok;
+            }
+
+        private:
+            bool write_at(const void* data, std::size_t size, std::uint64_t offset) {
+                const auto* bytes = static_cast<const char*>(data);
+                while (size > 0) {
+                    const ssize_t written = ::pwrite(fd_, bytes, size, offset);
+                    if (written <= 0) {
+                        return false;
+                    }
+                    bytes += written;
+                    size -= written;
+                    offset += written;
+                }
+                return true;
+            }
+
+            int fd_;
+            std::uint32_t content_type_;
+            std::uint32_t content_version_;
+            std::uint64_t table_offset_;
+            std::vector<binary_container_section> sections_;
+        };
+
+        // A container file mapped into memory. Move-only, the mapping lives as long as the object.
+        class mapped_binary_container {
+        public:
+            static std::optional<mapped_binary_container> open(
+                const boost::filesystem::path& path,
+                std::uint32_t content_type,
+                std::uint32_t content_version,
+                bool verify_checksums = true
+            ) {
+                mapped_binary_container result;
+                if (!result.map(path)) {
+                    return std::nullopt;
+                }
+                if (!is_binary_container(result.data_, result.size_)) {
+                    BOOST_LOG_TRIVIAL(error) << path << " is not a binary container";
+                    return std::nullopt;
+                }
+
+                binary_container_header header;
+                std::memcpy(&header, result.data_, sizeof(header));
+                if (header.container_version != binary_container_version ||
+                        header.content_type != content_type || header.content_version != content_version) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": unsupported container, version "
+                        << header.container_version << ", content " << header.content_type
+                        << " version " << header.content_version;
+                    return std::nullopt;
+                }
+
+                const std::size_t table_size = std::size_t(header.sections_amount) * sizeof(binary_container_section);
+                if (header.table_offset > result.size_ || table_size > result.size_ - header.table_offset) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": the section table is truncated";
+                    return std::nullopt;
+                }
+                result.sections_.resize(header.sections_amount);
+                std::memcpy(result.sections_.data(), result.data_ + header.table_offset, table_size);
+                if (detail::checksum(result.sections_.data(), table_size) != header.table_checksum) {
+                    BOOST_LOG_TRIVIAL(error) << path << ": the section table checksum does not match";
+                    return std::nullopt;
+                }
+
+                for (const binary_container_section& section : result.sections_) {
+                    if (section.offset % binary_container_alignment != 0 || section.offset > result.size_ ||
+                            section.size > result.size_ - section.offset ||
+                            section.element_size == 0 || section.size % section.element_size != 0) {
+                        BOOST_LOG_TRIVIAL(error) << path << ": section " << section.kind << ":" << section.key
+                            << " is out of bounds or misaligned";
+                        return std::nullopt;
+                    }
+                    if (verify_checksums && !result.verify_section(section)) {
+                        BOOST_LOG_TRIVIAL(error) << path << ": section " << section.kind << ":" << section.key
+                            << " checksum does not match";
+                        return std::nullopt;
+                    }
+                }
+                return result;
+            }
+
+            static bool is_binary_container(const std::uint8_t* data, std::size_t size) {
+                return size >= sizeof(binary_container_header) &&
+                       std::memcmp(data, detail::binary_container_magic, sizeof(detail::binary_container_magic)) == 0;
+            }
+
+            static bool is_binary_container(const boost::filesystem::path& path) {
+                std::ifstream in(path.c_str(), std::ios::binary);
+                char magic[sizeof(detail::binary_container_magic)];
+                return in.read(magic, sizeof(magic)) &&
+                       std::memcmp(magic, detail::binary_container_magic, sizeof(magic)) == 0;
+            }
+
+            mapped_binary_container(mapped_binary_container&& other)
+                : data_(std::exchange(other.data_, nullptr)),
+                  size_(std::exchange(other.size_, 0)),
+                  sections_(std::move(other.sections_)) {
+            }
+
+            mapped_binary_container& operator=(mapped_binary_container&& other) {
+                if (this != &other) {
+                    unmap();
+                    data_ = std::exchange(other.data_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                    sections_ = std::move(other.sections_);
+                }
+                return *this;
+            }
+
+            mapped_binary_container(const mapped_binary_container&) = delete;
+            mapped_binary_container& operator=(const mapped_binary_container&) = delete;
+
+            ~mapped_binary_container() {
+                unmap();
+            }
+
+            const std::vector<binary_container_section>& sections() const {
+                return sections_;
+            }
+
+            const binary_container_section* find_section(std::uint32_t kind, std::uint64_t key) const {
+                for (const binary_container_section& section : sections_) {
+                    if (section.kind == kind && section.key == key) {
+                        return &section;
+                    }
+                }
+                return nullptr;
+            }
+
+            // Returns an empty optional if the section stores elements of a different size.
+            template<typename T>
+            std::optional<array_view<T>> section_array(const binary_container_section& section) const {
+                if (section.element_size != sizeof(T)) {
+                    return std::nullopt;
+                }
+                return array_view<T>(reinterpret_cast<const T*>(data_ + section.offset), section.size / sizeof(T));
+            }
+
+            // Sections are not verified on open if verify_checksums was false, e.g. to check them in parallel later.
+            bool verify_section(const binary_container_section& section) const {
+                return detail::checksum(data_ + section.offset, section.size) == section.checksum;
+            }
+
+            array_view<std::uint8_t> section_bytes(const binary_container_section& section) const {
+                return array_view<std::uint8_t>(data_ + section.offset, section.size);
+            }
+
+        private:
+            mapped_binary_container() : data_(nullptr), size_(0) {}
+
+            bool map(const boost::filesystem::path& path) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                    return false;
+                }
+                struct stat st;
+                if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to read file: " << path;
+                    ::close(fd);
+                    return false;
+                }
+                void* mapping = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (mapping == MAP_FAILED) {
+                    BOOST_LOG_TRIVIAL(error) << "Unable to map file: " << path;
+                    return false;
+                }
+                // Sections are mostly read front to back.
+                ::madvise(mapping, st.st_size, MADV_SEQUENTIAL);
+                data_ = static_cast<const std::uint8_t*>(mapping);
+                size_ = st.st_size;
+                return true;
+            }
+
+            void unmap() {
+                if (data_ != nullptr) {
+                    ::munmap(const_cast<std::uint8_t*>(data_), size_);
+                    data_ = nullptr;
+                    size_ = 0;
+                }
+            }
+
+            const std::uint8_t* data_;
+            std::size_t size_;
+            std::vector<binary_container_section> sections_;
+        };
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_BINARY_CONTAINER_HPP
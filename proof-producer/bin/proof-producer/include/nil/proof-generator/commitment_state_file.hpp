@@ -0,0 +1,257 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_COMMITMENT_STATE_FILE_HPP
+#define PROOF_GENERATOR_COMMITMENT_STATE_FILE_HPP
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
+
+#include <nil/proof-generator/binary_container.hpp>
+
+namespace nil {
+    namespace proof_generator {
+        namespace commitment_state_file {
+            constexpr std::uint32_t content_type = 1;
+            constexpr std::uint32_t content_version = 1;
+
+            enum section_kind : std::uint32_t {
+                // Marshalled FRI params, etha, fixed batches and their values, evaluation points. All the small parts.
+                metadata = 1,
+                // For each batch {degree, size} of every polynomial, the key is the batch index.
+                polynomial_shapes = 2,
+                // For each batch the values of all its polynomials, one after another.
+                polynomial_values = 3,
+                // For each committed batch the nodes of its Merkle tree.
+                merkle_tree = 4,
+            };
+        } // namespace commitment_state_file
+
+        /*
+         * Saves the state of an LPC commitment scheme in a binary container. Polynomial values and Merkle tree nodes,
+         * which are almost all of the state, are written as raw arrays. Everything else goes through marshalling.
+         */
+        template<typename Endianness, typename LpcScheme>
+        bool write_commitment_state_file(const boost::filesystem::path& path, const LpcScheme& scheme) {
+            using polys_evaluator_type = typename LpcScheme::polys_evaluator_type;
+            using polynomial_value_type = typename LpcScheme::polynomial_type::value_type;
+            using node_value_type = typename LpcScheme::precommitment_type::value_type;
+
+            binary_container_writer writer(
+                path, commitment_state_file::content_type, commitment_state_file::content_version);
+            if (!writer.is_open()) {
+                BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path;
+                return false;
+            }
+
+            // Marshall a copy of the scheme without polynomials and trees.
+            const polys_evaluator_type& evaluator = scheme;
+            polys_evaluator_type evaluator_without_polys;
+            evaluator_without_polys._z = evaluator._z;
+            evaluator_without_polys._locked = evaluator._locked;
+            evaluator_without_polys._points = evaluator._points;
+            LpcScheme metadata_scheme(
+                std::move(evaluator_without_polys), {}, scheme.get_fri_params(), scheme.get_etha(),
+                scheme.get_batch_fixed(), scheme.get_fixed_polys_values());
+            auto filled_metadata =
+                nil::crypto3::marshalling::types::fill_commitment_scheme<Endianness, LpcScheme>(metadata_scheme);
+            std::vector<std::uint8_t> metadata(filled_metadata.length(), 0x00);
+            auto write_iter = metadata.begin();
+            if (filled_metadata.write(write_iter, metadata.size()) != nil::marshalling::status_type::success) {
+                BOOST_LOG_TRIVIAL(error) << "Commitment scheme metadata encoding failed";
+                return false;
+            }
+            writer.begin_section(commitment_state_file::metadata, 0, 1);
+            writer.write(metadata.data(), metadata.size());
+            writer.end_section();
+
+            for (const auto& [batch, polys] : evaluator._polys) {
+                writer.begin_section(commitment_state_file::polynomial_shapes, batch, sizeof(std::uint64_t));
+                for (const auto& poly : polys) {
+                    const std::array<std::uint64_t, 2> shape = {poly.degree(), poly.size()};
+                    writer.write_array(shape.data(), shape.size());
+                }
+                writer.end_section();
+
+                writer.begin_section(commitment_state_file::polynomial_values, batch, sizeof(polynomial_value_type));
+                for (const auto& poly : polys) {
+                    writer.write_array(&*poly.begin(), poly.size());
+                }
+                writer.end_section();
+            }
+
+            for (const auto& [batch, tree] : scheme.get_trees()) {
+                writer.begin_section(commitment_state_file::merkle_tree, batch, sizeof(node_value_type));
+                writer.write_array(&*tree.begin(), tree.size());
+                writer.end_section();
+            }
+
+            return writer.close();
+        }
+
+        /*
+         * A commitment scheme state file mapped into memory. Polynomial values and Merkle tree nodes can be read
+         * in place, make_commitment_scheme copies them once into the containers the scheme owns.
+         */
+        template<typename Endianness, typename LpcScheme>
+        class commitment_state_view {
+        public:
+            using polynomial_type = typename LpcScheme::polynomial_type;
+            using polynomial_value_type = typename polynomial_type::value_type;
+            using precommitment_type = typename LpcScheme::precommitment_type;
+            using node_value_type = typename precommitment_type::value_type;
+
+            static std::optional<commitment_state_view> open(
+                const boost::filesystem::path& path,
+                bool verify_checksums = true
+            ) {
+                auto container = mapped_binary_container::open(
+                    path, commitment_state_file::content_type, commitment_state_file::content_version,
+                    verify_checksums);
+                if (!container) {
+                    return std::nullopt;
+                }
+
+                commitment_state_view result(std::move(*container));
+                for (const binary_container_section& section : result.container_.sections()) {
+                    if (section.kind == commitment_state_file::polynomial_shapes) {
+                        if (!result.read_batch(section)) {
+                            BOOST_LOG_TRIVIAL(error) << path << ": polynomials of batch " << section.key
+                                << " do not match their shapes";
+                            return std::nullopt;
+                        }
+                    } else if (section.kind == commitment_state_file::merkle_tree) {
+                        auto nodes = result.container_.template section_array<node_value_type>(section);
+                        if (!nodes) {
+                            BOOST_LOG_TRIVIAL(error) << path << ": Merkle tree node size does not match";
+                            return std::nullopt;
+                        }
+                        result.trees_[section.key] = *nodes;
+                    }
+                }
+                return result;
+            }
+
+            const std::map<std::size_t, std::vector<array_view<polynomial_value_type>>>& polynomial_values() const {
+                return values_;
+            }
+
+            std::size_t polynomial_degree(std::size_t batch, std::size_t i) const {
+                return degrees_.at(batch)[i];
+            }
+
+            const std::map<std::size_t, array_view<node_value_type>>& merkle_tree_nodes() const {
+                return trees_;
+            }
+
+            std::optional<LpcScheme> make_commitment_scheme() const {
+                using namespace nil::crypto3::marshalling::types;
+                using TTypeBase = nil::marshalling::field_type<Endianness>;
+                using CommitmentStateMarshalling = typename commitment_scheme_state<TTypeBase, LpcScheme>::type;
+
+                const binary_container_section* metadata_section =
+                    container_.find_section(commitment_state_file::metadata, 0);
+                if (metadata_section == nullptr) {
+                    BOOST_LOG_TRIVIAL(error) << "Commitment state file has no metadata";
+                    return std::nullopt;
+                }
+                auto metadata = container_.section_bytes(*metadata_section);
+                CommitmentStateMarshalling marshalled_metadata;
+                auto read_iter = metadata.begin();
+                if (marshalled_metadata.read(read_iter, metadata.size()) != nil::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "Commitment scheme metadata decoding failed";
+                    return std::nullopt;
+                }
+                auto metadata_scheme =
+                    nil::crypto3::marshalling::types::make_commitment_scheme<Endianness, LpcScheme>(marshalled_metadata);
+                if (!metadata_scheme) {
+                    BOOST_LOG_TRIVIAL(error) << "Error decoding commitment scheme metadata";
+                    return std::nullopt;
+                }
+
+                typename LpcScheme::polys_evaluator_type evaluator = metadata_scheme.value();
+                for (const auto& [batch, values] : values_) {
+                    const std::vector<std::size_t>& degrees = degrees_.at(batch);
+                    std::vector<polynomial_type>& polys = evaluator._polys[batch];
+                    polys.reserve(values.size());
+                    for (std::size_t i = 0; i < values.size(); ++i) {
+                        polys.emplace_back(degrees[i], values[i].begin(), values[i].end());
+                    }
+                }
+
+                std::map<std::size_t, precommitment_type> trees;
+                for (const auto& [batch, nodes] : trees_) {
+                    trees.emplace(batch, precommitment_type(
+                        typename precommitment_type::container_type(nodes.begin(), nodes.end())));
+                }
+
+                return LpcScheme(
+                    std::move(evaluator), std::move(trees), metadata_scheme.value().get_fri_params(),
+                    metadata_scheme.value().get_etha(), metadata_scheme.value().get_batch_fixed(),
+                    metadata_scheme.value().get_fixed_polys_values());
+            }
+
+        private:
+            explicit commitment_state_view(mapped_binary_container&& container) : container_(std::move(container)) {}
+
+            bool read_batch(const binary_container_section& shapes_section) {
+                const std::size_t batch = shapes_section.key;
+                const binary_container_section* values_section =
+                    container_.find_section(commitment_state_file::polynomial_values, batch);
+                auto shapes = container_.template section_array<std::uint64_t>(shapes_section);
+                if (values_section == nullptr || !shapes || shapes->size() % 2 != 0) {
+                    return false;
+                }
+                auto values = container_.template section_array<polynomial_value_type>(*values_section);
+                if (!values) {
+                    return false;
+                }
+
+                std::vector<array_view<polynomial_value_type>>& batch_values = values_[batch];
+                std::vector<std::size_t>& batch_degrees = degrees_[batch];
+                std::size_t offset = 0;
+                for (std::size_t i = 0; i < shapes->size(); i += 2) {
+                    const std::size_t size = (*shapes)[i + 1];
+                    if (size > values->size() - offset) {
+                        return false;
+                    }
+                    batch_degrees.push_back((*shapes)[i]);
+                    batch_values.emplace_back(values->data() + offset, size);
+                    offset += size;
+                }
+                return offset == values->size();
+            }
+
+            mapped_binary_container container_;
+            std::map<std::size_t, std::vector<std::size_t>> degrees_;
+            std::map<std::size_t, std::vector<array_view<polynomial_value_type>>> values_;
+            std::map<std::size_t, array_view<node_value_type>> trees_;
+        };
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_COMMITMENT_STATE_FILE_HPP
@@ -46,6 +46,7 @@
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
 
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/detail/column_polynomial.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/profiling.hpp>
@@ -66,6 +67,9 @@
 #include <nil/proof-generator/output_artifacts/circuit_writer.hpp>
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
 #include <nil/proof-generator/file_operations.hpp>
+#include <nil/proof-generator/binary_container.hpp>
+#include <nil/proof-generator/assignment_table_file.hpp>
+#include <nil/proof-generator/commitment_state_file.hpp>
 
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 
@@ -124,7 +128,9 @@ namespace nil {
                 COMPUTE_COMBINED_Q = 9,
                 GENERATE_AGGREGATED_FRI_PROOF = 10,
                 GENERATE_CONSISTENCY_CHECKS_PROOF = 11,
-                MERGE_PROOFS = 12
+                MERGE_PROOFS = 12,
+                DAEMON = 13,
+                AGGREGATE = 14
             };
 
             ProverStage prover_stage_from_string(const std::string& stage) {
@@ -141,7 +147,9 @@ namespace nil {
                     {"compute-combined-Q", ProverStage::COMPUTE_COMBINED_Q},
                     {"merge-proofs", ProverStage::MERGE_PROOFS},
                     {"aggregated-FRI", ProverStage::GENERATE_AGGREGATED_FRI_PROOF},
-                    {"consistency-checks", ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF}
+                    {"consistency-checks", ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF},
+                    {"daemon", ProverStage::DAEMON},
+                    {"aggregate", ProverStage::AGGREGATE}
                 };
                 auto it = stage_map.find(stage);
                 if (it == stage_map.end()) {
@@ -164,6 +172,7 @@ namespace nil {
             using CircuitParams = nil::crypto3::zk::snark::placeholder_circuit_params<BlueprintField>;
             using PlaceholderParams = nil::crypto3::zk::snark::placeholder_params<CircuitParams, LpcScheme>;
             using Proof = nil::crypto3::zk::snark::placeholder_proof<BlueprintField, PlaceholderParams>;
+            using AggregatedProof = nil::crypto3::zk::snark::placeholder_aggregated_proof<BlueprintField, PlaceholderParams>;
             using PublicPreprocessedData = typename nil::crypto3::zk::snark::
                 placeholder_public_preprocessor<BlueprintField, PlaceholderParams>::preprocessed_data_type;
             using CommonData = typename PublicPreprocessedData::common_data_type;
@@ -307,15 +316,8 @@ namespace nil {
             }
 
             // The caller must call the preprocessor or load the preprocessed data before calling this function.
-            bool generate_partial_proof_to_file(
-                    boost::filesystem::path proof_file_,
-                    std::optional<boost::filesystem::path> challenge_file_,
-                    std::optional<boost::filesystem::path> theta_power_file) {
-                if (!can_write_to_file(proof_file_.string())) {
-                    BOOST_LOG_TRIVIAL(error) << "Can't write to file " << proof_file_;
-                    return false;
-                }
-
+            // Leaves the commitment scheme ready for computing combined Q and the consistency checks.
+            Proof generate_partial_proof() {
                 BOOST_ASSERT(public_preprocessed_data_);
                 BOOST_ASSERT(private_preprocessed_data_);
                 BOOST_ASSERT(table_description_);
@@ -338,6 +340,30 @@ namespace nil {
 
                 lpc_scheme_.emplace(prover.move_commitment_scheme()); // get back the commitment scheme used in prover
 
+                lpc_scheme_->state_commited(crypto3::zk::snark::FIXED_VALUES_BATCH);
+                lpc_scheme_->state_commited(crypto3::zk::snark::VARIABLE_VALUES_BATCH);
+                lpc_scheme_->state_commited(crypto3::zk::snark::PERMUTATION_BATCH);
+                lpc_scheme_->state_commited(crypto3::zk::snark::QUOTIENT_BATCH);
+                lpc_scheme_->state_commited(crypto3::zk::snark::LOOKUP_BATCH);
+                lpc_scheme_->mark_batch_as_fixed(crypto3::zk::snark::FIXED_VALUES_BATCH);
+
+                lpc_scheme_->set_fixed_polys_values(common_data_.has_value() ? common_data_->commitment_scheme_data :
+                                                                                    public_preprocessed_data_->common_data.commitment_scheme_data);
+                return proof;
+            }
+
+            // The caller must call the preprocessor or load the preprocessed data before calling this function.
+            bool generate_partial_proof_to_file(
+                    boost::filesystem::path proof_file_,
+                    std::optional<boost::filesystem::path> challenge_file_,
+                    std::optional<boost::filesystem::path> theta_power_file) {
+                if (!can_write_to_file(proof_file_.string())) {
+                    BOOST_LOG_TRIVIAL(error) << "Can't write to file " << proof_file_;
+                    return false;
+                }
+
+                Proof proof = generate_partial_proof();
+
                 BOOST_LOG_TRIVIAL(info) << "Writing proof to " << proof_file_;
                 auto filled_placeholder_proof =
                     nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params());
@@ -375,19 +401,7 @@ namespace nil {
                     BOOST_LOG_TRIVIAL(error) << "Failed to write challenge to file.";
                 }
 
-                lpc_scheme_.emplace(prover.move_commitment_scheme());
-
-                lpc_scheme_->state_commited(crypto3::zk::snark::FIXED_VALUES_BATCH);
-                lpc_scheme_->state_commited(crypto3::zk::snark::VARIABLE_VALUES_BATCH);
-                lpc_scheme_->state_commited(crypto3::zk::snark::PERMUTATION_BATCH);
-                lpc_scheme_->state_commited(crypto3::zk::snark::QUOTIENT_BATCH);
-                lpc_scheme_->state_commited(crypto3::zk::snark::LOOKUP_BATCH);
-                lpc_scheme_->mark_batch_as_fixed(crypto3::zk::snark::FIXED_VALUES_BATCH);
-
-                lpc_scheme_->set_fixed_polys_values(common_data_.has_value() ? common_data_->commitment_scheme_data :
-                                                                                    public_preprocessed_data_->common_data.commitment_scheme_data);
-
-                std::size_t theta_power = lpc_scheme_->compute_theta_power_for_combined_Q();
+                std::size_t theta_power = compute_theta_power_for_combined_Q();
 
                 auto output_file = open_file<std::ofstream>(theta_power_file->string(), std::ios_base::out);
                 (*output_file) << theta_power << std::endl;
@@ -396,6 +410,11 @@ namespace nil {
                 return res;
             }
 
+            // Must be called after generate_partial_proof.
+            std::size_t compute_theta_power_for_combined_Q() {
+                return lpc_scheme_->compute_theta_power_for_combined_Q();
+            }
+
             bool verify_from_file(boost::filesystem::path proof_file_) {
                 create_lpc_scheme();
 
@@ -490,17 +509,10 @@ namespace nil {
             }
 
             bool save_commitment_state_to_file(boost::filesystem::path commitment_scheme_state_file) {
-                using namespace nil::crypto3::marshalling::types;
-
                 BOOST_LOG_TRIVIAL(info) << "Writing commitment_state to " <<
                     commitment_scheme_state_file;
 
-                auto marshalled_lpc_state = fill_commitment_scheme<Endianness, LpcScheme>(
-                    *lpc_scheme_);
-                bool res = detail::encode_marshalling_to_file(
-                    commitment_scheme_state_file,
-                    marshalled_lpc_state
-                );
+                bool res = write_commitment_state_file<Endianness>(commitment_scheme_state_file, *lpc_scheme_);
                 if (res) {
                     BOOST_LOG_TRIVIAL(info) << "Commitment scheme written.";
                 }
@@ -510,6 +522,20 @@ namespace nil {
             bool read_commitment_scheme_from_file(boost::filesystem::path commitment_scheme_state_file) {
                 BOOST_LOG_TRIVIAL(info) << "Read commitment scheme from " << commitment_scheme_state_file;
 
+                if (mapped_binary_container::is_binary_container(commitment_scheme_state_file)) {
+                    auto state = commitment_state_view<Endianness, LpcScheme>::open(commitment_scheme_state_file);
+                    if (!state) {
+                        return false;
+                    }
+                    auto commitment_scheme = state->make_commitment_scheme();
+                    if (!commitment_scheme) {
+                        return false;
+                    }
+                    lpc_scheme_.emplace(std::move(commitment_scheme.value()));
+                    return true;
+                }
+
+                // Files written before the binary container was introduced hold the whole marshalled state.
                 using namespace nil::crypto3::marshalling::types;
 
                 using CommitmentStateMarshalling = typename commitment_scheme_state<TTypeBase, LpcScheme>::type;
@@ -599,20 +625,36 @@ namespace nil {
             bool read_assignment_table(const boost::filesystem::path& assignment_table_file_path) {
                 BOOST_LOG_TRIVIAL(info) << "Read assignment table from " << assignment_table_file_path;
 
+                auto table = load_assignment_table(assignment_table_file_path);
+                if (!table) {
+                    return false;
+                }
+                return set_assignment_table(std::move(table->second), table->first);
+            }
+
+            // Does not touch the prover state, so it may run concurrently with proving, see ProverDaemon.
+            static std::optional<std::pair<TableDescription, AssignmentTable>> load_assignment_table(
+                const boost::filesystem::path& assignment_table_file_path
+            ) {
+                if (mapped_binary_container::is_binary_container(assignment_table_file_path)) {
+                    return read_assignment_table_file<BlueprintField>(assignment_table_file_path);
+                }
+
+                // Tables written by the marshalling based assignment_table_writer.
                 auto marshalled_table =
                     detail::decode_marshalling_from_file<TableMarshalling>(assignment_table_file_path);
                 if (!marshalled_table) {
-                    return false;
+                    return std::nullopt;
                 }
-            
-                auto [table_description, assignment_table] =
-                    nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(
-                        *marshalled_table
-                    );
+                return nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(
+                    *marshalled_table
+                );
+            }
+
+            bool set_assignment_table(AssignmentTable&& assignment_table, const TableDescription& table_description) {
                 table_description_.emplace(table_description);
                 assignment_table_.emplace(std::move(assignment_table));
                 public_inputs_.emplace(assignment_table_->public_inputs());
-
                 return true;
             }
 
@@ -640,17 +682,12 @@ namespace nil {
                     return false;
                 }
 
-                std::ofstream out(output_filename.string(), std::ios::binary | std::ios::out);
-                if (!out.is_open()) {
-                    BOOST_LOG_TRIVIAL(error) << "Failed to open file " << output_filename;
-                    return false;
-                }
-
-                writer::write_binary_assignment(
-                    out, assignment_table_.value(), table_description_.value()
+                return write_assignment_table_file<BlueprintField>(
+                    output_filename,
+                    assignment_table_.value(),
+                    table_description_.value(),
+                    writer::padded_rows_amount(table_description_->usable_rows_amount)
                 );
-
-                return true;
             }
 
             bool print_debug_assignment_table(const OutputArtifacts& opts) {
@@ -768,11 +805,15 @@ namespace nil {
                     (challenge_file, marshalled_challenge);
             }
 
-            void create_lpc_scheme() {
+            FriParams make_fri_params() const {
                 // Lambdas and grinding bits should be passed through preprocessor directives
                 std::size_t table_rows_log = std::ceil(std::log2(table_description_->rows_amount));
 
-                lpc_scheme_.emplace(FriParams(1, table_rows_log, lambda_, expand_factor_, grind_!=0, grind_));
+                return FriParams(1, table_rows_log, lambda_, expand_factor_, grind_!=0, grind_);
+            }
+
+            void create_lpc_scheme() {
+                lpc_scheme_.emplace(make_fri_params());
             }
 
             bool preprocess_public_data() {
@@ -797,6 +838,48 @@ namespace nil {
                 return true;
             }
 
+            /**
+             * Public preprocessing depends only on the circuit, the table description and the fixed columns, i.e.
+             * constants and selectors. When several proofs are generated for the same circuit, the result of the
+             * first preprocessing is kept, and for the next tables with the same description and fixed columns only
+             * the public input polynomials are rebuilt, while the commitment scheme is restored from the copy made
+             * right after preprocessing. Otherwise public data is preprocessed again and becomes the kept one.
+             */
+            bool reuse_or_preprocess_public_data(bool& reused) {
+                reused = public_preprocessing_snapshot_.has_value() &&
+                         public_preprocessing_snapshot_->matches(*table_description_, *assignment_table_);
+                if (!reused) {
+                    public_preprocessing_snapshot_.reset();
+                    public_preprocessing_snapshot_.emplace(public_preprocessing_snapshot{
+                        *table_description_,
+                        assignment_table_->constants(),
+                        assignment_table_->selectors(),
+                        std::nullopt
+                    });
+                    if (!preprocess_public_data()) {
+                        public_preprocessing_snapshot_.reset();
+                        return false;
+                    }
+                    public_preprocessing_snapshot_->lpc_scheme.emplace(*lpc_scheme_);
+                    return true;
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Reusing preprocessed public data";
+                public_inputs_.emplace(assignment_table_->public_inputs());
+                lpc_scheme_.emplace(*public_preprocessing_snapshot_->lpc_scheme);
+
+                using PublicPolynomialTable = typename PublicPreprocessedData::plonk_public_polynomial_dfs_table_type;
+                auto public_table = assignment_table_->move_public_table();
+                const auto& polynomial_table = *public_preprocessed_data_->public_polynomial_table;
+                public_preprocessed_data_->public_polynomial_table = std::make_shared<PublicPolynomialTable>(
+                    nil::crypto3::zk::snark::detail::column_range_polynomial_dfs<BlueprintField>(
+                        public_table->public_inputs(), public_preprocessed_data_->common_data.basic_domain),
+                    polynomial_table.constants(),
+                    polynomial_table.selectors()
+                );
+                return true;
+            }
+
             bool preprocess_private_data() {
 
                 BOOST_LOG_TRIVIAL(info) << "Preprocessing private data";
@@ -824,24 +907,34 @@ namespace nil {
                 }
                 BOOST_LOG_TRIVIAL(info) << "Generating aggregated challenge to " << aggregated_challenge_file;
 
-                // create the transcript
-                using transcript_hash_type = typename PlaceholderParams::transcript_hash_type;
-                using transcript_type = crypto3::zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
-                transcript_type transcript;
-
-                // read challenges from input files and add them to the transcript
+                // read challenges from input files
+                std::vector<typename BlueprintField::value_type> challenges;
                 for (const auto &input_file : aggregate_input_files) {
                     std::optional<typename BlueprintField::value_type> challenge = read_challenge(input_file);
                     if (!challenge) {
                         return false;
                     }
-                    transcript(challenge.value());
+                    challenges.push_back(challenge.value());
                 }
 
-                // produce the aggregated challenge
-                auto output_challenge = transcript.template challenge<BlueprintField>();
+                return save_challenge(aggregated_challenge_file, aggregate_challenges(challenges));
+            }
+
+            // The challenges of the partial proofs, in the order of the provers.
+            static typename BlueprintField::value_type aggregate_challenges(
+                const std::vector<typename BlueprintField::value_type>& challenges
+            ) {
+                // create the transcript
+                using transcript_hash_type = typename PlaceholderParams::transcript_hash_type;
+                using transcript_type = crypto3::zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                transcript_type transcript;
 
-                return save_challenge(aggregated_challenge_file, output_challenge);
+                for (const auto& challenge : challenges) {
+                    transcript(challenge);
+                }
+
+                // produce the aggregated challenge
+                return transcript.template challenge<BlueprintField>();
             }
 
             // NOTE: PolynomialType is not required to match polynomial_type.
@@ -890,11 +983,16 @@ namespace nil {
                 if (!challenge) {
                     return false;
                 }
-                polynomial_type combined_Q = lpc_scheme_->prepare_combined_Q(
-                    challenge.value(), starting_power);
+                polynomial_type combined_Q = compute_combined_Q(challenge.value(), starting_power);
                 return save_poly_to_file(combined_Q, output_combined_Q_file);
             }
 
+            polynomial_type compute_combined_Q(
+                const typename BlueprintField::value_type& aggregated_challenge,
+                std::size_t starting_power) {
+                return lpc_scheme_->prepare_combined_Q(aggregated_challenge, starting_power);
+            }
+
             bool merge_proofs(
                 const std::vector<boost::filesystem::path> &partial_proof_files,
                 const std::vector<boost::filesystem::path> &initial_proof_files,
@@ -902,8 +1000,7 @@ namespace nil {
                 const boost::filesystem::path &merged_proof_file)
             {
                 /* ZK types */
-                using placeholder_aggregated_proof_type = nil::crypto3::zk::snark::
-                    placeholder_aggregated_proof<BlueprintField, PlaceholderParams>;
+                using placeholder_aggregated_proof_type = AggregatedProof;
 
                 using partial_proof_type = Proof;
 
@@ -919,9 +1016,6 @@ namespace nil {
                 using fri_proof_marshalling_type = nil::crypto3::marshalling::types::
                     initial_fri_proof_type<TTypeBase, LpcScheme>;
 
-                using merged_proof_marshalling_type = nil::crypto3::marshalling::types::
-                    placeholder_aggregated_proof_type<TTypeBase, placeholder_aggregated_proof_type>;
-
 
                 placeholder_aggregated_proof_type merged_proof;
 
@@ -969,11 +1063,21 @@ namespace nil {
                 merged_proof.aggregated_proof.fri_proof =
                     nil::crypto3::marshalling::types::make_initial_fri_proof<Endianness, LpcScheme>(*marshalled_fri_proof);
 
+                return save_aggregated_proof_to_file(merged_proof, lpc_scheme_->get_fri_params(), merged_proof_file);
+            }
+
+            bool save_aggregated_proof_to_file(
+                const AggregatedProof& merged_proof,
+                const FriParams& fri_params,
+                const boost::filesystem::path& merged_proof_file)
+            {
+                using merged_proof_marshalling_type = nil::crypto3::marshalling::types::
+                    placeholder_aggregated_proof_type<TTypeBase, AggregatedProof>;
+
                 BOOST_LOG_TRIVIAL(info) << "Writing merged proof to \"" << merged_proof_file << "\"";
 
                 auto marshalled_proof = nil::crypto3::marshalling::types::fill_placeholder_aggregated_proof
-                    <Endianness, placeholder_aggregated_proof_type, partial_proof_type>
-                    (merged_proof, lpc_scheme_->get_fri_params());
+                    <Endianness, AggregatedProof, Proof>(merged_proof, fri_params);
 
                 return detail::encode_marshalling_to_file<merged_proof_marshalling_type>(merged_proof_file, marshalled_proof);
             }
@@ -1056,13 +1160,6 @@ namespace nil {
                     return false;
                 }
 
-                // create the transcript
-                using transcript_hash_type = typename PlaceholderParams::transcript_hash_type;
-                using transcript_type = crypto3::zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
-                transcript_type transcript;
-
-                transcript(aggregated_challenge.value());
-
                 // Sum up all the polynomials from the files.
                 polynomial_type sum_poly;
                 for (const auto& path : input_combined_Q_polynomial_files) {
@@ -1072,16 +1169,40 @@ namespace nil {
                     }
                     sum_poly += next_combined_Q.value();
                 }
-                create_lpc_scheme();
-                auto [fri_proof, challenges] = lpc_scheme_->proof_eval_FRI_proof(sum_poly, transcript);
+                AggregatedFriProof aggregated_fri_proof = generate_aggregated_FRI_proof(
+                    aggregated_challenge.value(), sum_poly);
+
+                return save_fri_proof_to_file(aggregated_fri_proof.fri_proof, aggregated_fri_proof_output_file) &&
+                    save_proof_of_work(aggregated_fri_proof.proof_of_work, proof_of_work_output_file) &&
+                    save_challenge_vector_to_file(aggregated_fri_proof.challenges, consistency_checks_challenges_output_file);
+            }
+
+            struct AggregatedFriProof {
+                typename LpcScheme::fri_proof_type fri_proof;
+                std::vector<typename BlueprintField::value_type> challenges;
+                typename FriType::grinding_type::output_type proof_of_work;
+            };
+
+            // sum_poly is the sum of combined Q polynomials of all the partial provers, it is changed by FRI.
+            // Uses a fresh commitment scheme, the one of this prover is left untouched.
+            AggregatedFriProof generate_aggregated_FRI_proof(
+                const typename BlueprintField::value_type& aggregated_challenge,
+                polynomial_type& sum_poly) const {
+                // create the transcript
+                using transcript_hash_type = typename PlaceholderParams::transcript_hash_type;
+                using transcript_type = crypto3::zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                transcript_type transcript;
+
+                transcript(aggregated_challenge);
+
+                LpcScheme lpc_scheme(make_fri_params());
+                auto [fri_proof, challenges] = lpc_scheme.proof_eval_FRI_proof(sum_poly, transcript);
 
                 // And finally run proof of work.
                 typename FriType::grinding_type::output_type proof_of_work = nil::crypto3::zk::algorithms::run_grinding<FriType>(
-                    lpc_scheme_->get_fri_params(), transcript);
+                    lpc_scheme.get_fri_params(), transcript);
 
-                return save_fri_proof_to_file(fri_proof, aggregated_fri_proof_output_file) &&
-                    save_proof_of_work(proof_of_work, proof_of_work_output_file) &&
-                    save_challenge_vector_to_file(challenges, consistency_checks_challenges_output_file);
+                return {std::move(fri_proof), std::move(challenges), proof_of_work};
             }
 
             bool save_lpc_consistency_proof_to_file(
@@ -1113,12 +1234,18 @@ namespace nil {
                 if (!combined_Q)
                     return false;
 
-                typename LpcScheme::lpc_proof_type proof = lpc_scheme_->proof_eval_lpc_proof(
+                typename LpcScheme::lpc_proof_type proof = generate_consistency_checks(
                     combined_Q.value(), challenges.value());
 
                 return save_lpc_consistency_proof_to_file(proof, output_proof_file);
             }
 
+            typename LpcScheme::lpc_proof_type generate_consistency_checks(
+                const polynomial_type& combined_Q,
+                const std::vector<typename BlueprintField::value_type>& challenges) {
+                return lpc_scheme_->proof_eval_lpc_proof(combined_Q, challenges);
+            }
+
             bool setup_prover() {
                 auto start = std::chrono::high_resolution_clock::now();
                 const auto err = CircuitFactory<BlueprintField>::initialize_circuit(circuit_name_, constraint_system_, assignment_table_, table_description_);
@@ -1136,11 +1263,20 @@ namespace nil {
                 return constraint_system_.value();
             }
 
+            bool has_assignment_table() const {
+                return assignment_table_.has_value();
+            }
+
             const AssignmentTable& get_assignment_table() const {
                 BOOST_ASSERT(assignment_table_);
                 return assignment_table_.value();
             }
 
+            const TableDescription& get_table_description() const {
+                BOOST_ASSERT(table_description_);
+                return table_description_.value();
+            }
+
             bool fill_assignment_table(const boost::filesystem::path& trace_file_path) {
                 if (!constraint_system_.has_value()) {
                     BOOST_LOG_TRIVIAL(error) << "Circuit is not initialized";
@@ -1159,6 +1295,23 @@ namespace nil {
             }
 
         private:
+            struct public_preprocessing_snapshot {
+                TableDescription table_description;
+                typename AssignmentTable::constant_container_type constants;
+                typename AssignmentTable::selector_container_type selectors;
+                std::optional<LpcScheme> lpc_scheme;
+
+                bool matches(const TableDescription& desc, const AssignmentTable& table) const {
+                    return desc.witness_columns == table_description.witness_columns &&
+                           desc.public_input_columns == table_description.public_input_columns &&
+                           desc.constant_columns == table_description.constant_columns &&
+                           desc.selector_columns == table_description.selector_columns &&
+                           desc.usable_rows_amount == table_description.usable_rows_amount &&
+                           desc.rows_amount == table_description.rows_amount &&
+                           table.constants() == constants && table.selectors() == selectors;
+                }
+            };
+
             const std::size_t expand_factor_;
             const std::size_t max_quotient_chunks_;
             const std::size_t lambda_;
@@ -1177,6 +1330,7 @@ namespace nil {
             std::optional<ConstraintSystem> constraint_system_;
             std::optional<AssignmentTable> assignment_table_;
             std::optional<LpcScheme> lpc_scheme_;
+            std::optional<public_preprocessing_snapshot> public_preprocessing_snapshot_;
         };
 
     } // namespace proof_generator
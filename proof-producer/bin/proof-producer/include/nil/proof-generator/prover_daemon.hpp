@@ -0,0 +1,409 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Martun Karapetyan <martun@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_PROVER_DAEMON_HPP
+#define PROOF_GENERATOR_PROVER_DAEMON_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/proof-generator/assigner/assigner.hpp>
+#include <nil/proof-generator/prover.hpp>
+
+namespace nil {
+    namespace proof_generator {
+        /*
+         * A job file is a list of key=value lines, empty lines and lines starting with '#' are skipped:
+         *   trace=<path> or assignment-table=<path>  the input of the job, one of them
+         *   proof=<path>                             the proof output file
+         *   json=<path>                              optional, the JSON proof output file, defaults to <proof>.json
+         *   verify=true|false                        optional, verify the proof after generation, defaults to false
+         * Relative paths are resolved against the spool directory.
+         */
+        struct prover_job {
+            std::string name;
+            boost::filesystem::path trace_file_path;
+            boost::filesystem::path assignment_table_file_path;
+            boost::filesystem::path proof_file_path;
+            boost::filesystem::path json_file_path;
+            bool verify = false;
+        };
+
+        namespace detail {
+            inline std::optional<std::string> read_prover_job(
+                const boost::filesystem::path& job_file_path,
+                const boost::filesystem::path& base_dir,
+                prover_job& job
+            ) {
+                std::ifstream job_file(job_file_path.string());
+                if (!job_file.is_open()) {
+                    return "Can't open job file " + job_file_path.string();
+                }
+
+                auto resolve = [&base_dir](const std::string& value) {
+                    boost::filesystem::path path(value);
+                    return path.is_absolute() ? path : base_dir / path;
+                };
+
+                std::string line;
+                while (std::getline(job_file, line)) {
+                    if (line.empty() || line[0] == '#') {
+                        continue;
+                    }
+                    const std::size_t separator = line.find('=');
+                    if (separator == std::string::npos) {
+                        return "Malformed line in job file: " + line;
+                    }
+                    const std::string key = line.substr(0, separator);
+                    const std::string value = line.substr(separator + 1);
+                    if (key == "trace") {
+                        job.trace_file_path = resolve(value);
+                    } else if (key == "assignment-table") {
+                        job.assignment_table_file_path = resolve(value);
+                    } else if (key == "proof") {
+                        job.proof_file_path = resolve(value);
+                    } else if (key == "json") {
+                        job.json_file_path = resolve(value);
+                    } else if (key == "verify") {
+                        job.verify = value == "true" || value == "1";
+                    } else {
+                        return "Unknown key in job file: " + key;
+                    }
+                }
+
+                if (job.trace_file_path.empty() == job.assignment_table_file_path.empty()) {
+                    return std::string("Job should have either a trace or an assignment table");
+                }
+                if (job.proof_file_path.empty()) {
+                    return std::string("Job has no proof file");
+                }
+                if (job.json_file_path.empty()) {
+                    job.json_file_path = job.proof_file_path.string() + ".json";
+                }
+                return std::nullopt;
+            }
+
+            /*
+             * Jobs are put into the spool directory as <name>.job files. A job is claimed by renaming it to
+             * <name>.running, so several daemons may share one directory. When the job is done, <name>.report is
+             * written and <name>.running is removed. A file named "stop" asks the daemons to exit once there are
+             * no more jobs.
+             */
+            class spool_directory {
+            public:
+                explicit spool_directory(const boost::filesystem::path& path) : path_(path) {}
+
+                const boost::filesystem::path& path() const {
+                    return path_;
+                }
+
+                bool stop_requested() const {
+                    return boost::filesystem::exists(path_ / "stop");
+                }
+
+                // Returns the name of the claimed job, the earliest one by name.
+                std::optional<std::string> claim_next_job() const {
+                    std::vector<std::string> names;
+                    boost::system::error_code ec;
+                    for (boost::filesystem::directory_iterator it(path_, ec), end; !ec && it != end; it.increment(ec)) {
+                        if (it->path().extension() == ".job" && boost::filesystem::is_regular_file(it->status())) {
+                            names.push_back(it->path().stem().string());
+                        }
+                    }
+                    std::sort(names.begin(), names.end());
+
+                    for (const std::string& name : names) {
+                        boost::filesystem::rename(job_file(name, ".job"), job_file(name, ".running"), ec);
+                        if (!ec) {
+                            return name;
+                        }
+                    }
+                    return std::nullopt;
+                }
+
+                // The report appears at once, readers never see a partially written one.
+                bool finish_job(const std::string& name, const std::string& report) const {
+                    const boost::filesystem::path report_path = job_file(name, ".report");
+                    const boost::filesystem::path tmp_path = job_file(name, ".report.tmp");
+                    {
+                        std::ofstream out(tmp_path.string(), std::ios_base::out | std::ios_base::trunc);
+                        if (!out.is_open() || !(out << report)) {
+                            BOOST_LOG_TRIVIAL(error) << "Can't write job report " << tmp_path;
+                            return false;
+                        }
+                    }
+                    boost::system::error_code ec;
+                    boost::filesystem::rename(tmp_path, report_path, ec);
+                    if (ec) {
+                        BOOST_LOG_TRIVIAL(error) << "Can't write job report " << report_path << ": " << ec.message();
+                        return false;
+                    }
+                    boost::filesystem::remove(job_file(name, ".running"), ec);
+                    return true;
+                }
+
+                boost::filesystem::path job_file(const std::string& name, const std::string& extension) const {
+                    return path_ / (name + extension);
+                }
+
+            private:
+                boost::filesystem::path path_;
+            };
+
+            // Blocking queue of limited capacity, pop returns nothing once the queue is closed and drained.
+            template<typename Item>
+            class bounded_queue {
+            public:
+                explicit bounded_queue(std::size_t capacity) : capacity_(capacity) {}
+
+                void push(Item&& item) {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    not_full_.wait(lock, [this] { return items_.size() < capacity_; });
+                    items_.push_back(std::move(item));
+                    not_empty_.notify_one();
+                }
+
+                std::optional<Item> pop() {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    not_empty_.wait(lock, [this] { return !items_.empty() || closed_; });
+                    if (items_.empty()) {
+                        return std::nullopt;
+                    }
+                    Item item = std::move(items_.front());
+                    items_.pop_front();
+                    not_full_.notify_one();
+                    return item;
+                }
+
+                void close() {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    closed_ = true;
+                    not_empty_.notify_all();
+                }
+
+            private:
+                const std::size_t capacity_;
+                std::deque<Item> items_;
+                bool closed_ = false;
+                std::mutex mutex_;
+                std::condition_variable not_full_;
+                std::condition_variable not_empty_;
+            };
+
+            class stage_timings {
+            public:
+                template<typename Function>
+                auto measure(const std::string& stage, Function f) {
+                    auto start = std::chrono::high_resolution_clock::now();
+                    auto result = f();
+                    timings_.emplace_back(stage, std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::high_resolution_clock::now() - start));
+                    return result;
+                }
+
+                void print(std::ostream& out) const {
+                    for (const auto& [stage, duration] : timings_) {
+                        out << stage << "-ms=" << duration.count() << "\n";
+                    }
+                }
+
+            private:
+                std::vector<std::pair<std::string, std::chrono::milliseconds>> timings_;
+            };
+        } // namespace detail
+
+        /*
+         * Serves proof jobs from a spool directory for a single circuit, until asked to stop. The circuit is loaded
+         * once, and the preprocessed public data is reused by all the jobs with the same table description and fixed
+         * columns. Evaluation domains and the thread pool also outlive the jobs. The assignment table of the next job
+         * is loaded, or filled from its trace, in a separate thread while the current job is proven.
+         */
+        template<typename CurveType, typename HashType>
+        class ProverDaemon {
+        public:
+            using ProverType = Prover<CurveType, HashType>;
+            using AssignmentTable = typename ProverType::AssignmentTable;
+            using TableDescription = typename ProverType::TableDescription;
+
+            // The prover should have the circuit, and the preset assignment table for trace jobs.
+            ProverDaemon(
+                ProverType& prover,
+                const std::string& circuit_name,
+                const boost::filesystem::path& spool_dir_path,
+                std::chrono::milliseconds poll_interval = std::chrono::milliseconds(200)
+            ) : prover_(prover),
+                circuit_name_(circuit_name),
+                spool_(spool_dir_path),
+                poll_interval_(poll_interval),
+                // One table waits while another one is proven, so at most three tables are in memory.
+                loaded_jobs_(1) {
+            }
+
+            bool run() {
+                if (!boost::filesystem::is_directory(spool_.path())) {
+                    BOOST_LOG_TRIVIAL(error) << "Spool directory " << spool_.path() << " does not exist";
+                    return false;
+                }
+                if (prover_.has_assignment_table()) {
+                    preset_table_.emplace(prover_.get_assignment_table());
+                    preset_table_description_.emplace(prover_.get_table_description());
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Waiting for jobs in " << spool_.path();
+                std::thread assigner([this] { load_jobs(); });
+                while (auto job = loaded_jobs_.pop()) {
+                    prove_job(*job);
+                }
+                assigner.join();
+                BOOST_LOG_TRIVIAL(info) << "Stop requested, exiting";
+                return true;
+            }
+
+        private:
+            struct loaded_job {
+                prover_job job;
+                std::optional<std::pair<TableDescription, AssignmentTable>> table;
+                std::optional<std::string> error;
+                detail::stage_timings timings;
+                std::chrono::high_resolution_clock::time_point start;
+            };
+
+            void load_jobs() {
+                while (true) {
+                    // Jobs put before the stop file are still served.
+                    const bool stop_requested = spool_.stop_requested();
+                    std::optional<std::string> name = spool_.claim_next_job();
+                    if (!name) {
+                        if (stop_requested) {
+                            break;
+                        }
+                        std::this_thread::sleep_for(poll_interval_);
+                        continue;
+                    }
+                    loaded_jobs_.push(load_job(*name));
+                }
+                loaded_jobs_.close();
+            }
+
+            loaded_job load_job(const std::string& name) {
+                loaded_job result;
+                result.start = std::chrono::high_resolution_clock::now();
+                result.job.name = name;
+                BOOST_LOG_TRIVIAL(info) << "Loading job " << name;
+
+                result.error = detail::read_prover_job(spool_.job_file(name, ".running"), spool_.path(), result.job);
+                if (result.error) {
+                    return result;
+                }
+
+                try {
+                    if (!result.job.assignment_table_file_path.empty()) {
+                        result.table = result.timings.measure("load-assignment-table", [&] {
+                            return ProverType::load_assignment_table(result.job.assignment_table_file_path);
+                        });
+                        if (!result.table) {
+                            result.error = "Can't read assignment table " + result.job.assignment_table_file_path.string();
+                        }
+                    } else {
+                        result.error = result.timings.measure("fill-assignment", [&] {
+                            return fill_assignment_table(result.job.trace_file_path, result.table);
+                        });
+                    }
+                } catch (const std::exception& e) {
+                    result.error = e.what();
+                }
+                return result;
+            }
+
+            std::optional<std::string> fill_assignment_table(
+                const boost::filesystem::path& trace_file_path,
+                std::optional<std::pair<TableDescription, AssignmentTable>>& table
+            ) const {
+                if (!preset_table_) {
+                    return std::string("Circuit was read from file, jobs should provide assignment tables");
+                }
+                table.emplace(*preset_table_description_, *preset_table_);
+                return fill_assignment_table_single_thread(table->second, table->first, circuit_name_, trace_file_path);
+            }
+
+            void prove_job(loaded_job& job) {
+                bool reused = false;
+                if (!job.error) {
+                    try {
+                        prover_.set_assignment_table(std::move(job.table->second), job.table->first);
+                        job.table.reset();
+                        const bool proved =
+                            job.timings.measure("preprocess-public", [&] {
+                                return prover_.reuse_or_preprocess_public_data(reused);
+                            }) &&
+                            job.timings.measure("preprocess-private", [&] {
+                                return prover_.preprocess_private_data();
+                            }) &&
+                            job.timings.measure("prove", [&] {
+                                return prover_.generate_to_file(
+                                    job.job.proof_file_path, job.job.json_file_path, !job.job.verify);
+                            });
+                        if (!proved) {
+                            job.error = "Proof generation failed, see the prover log";
+                        }
+                    } catch (const std::exception& e) {
+                        job.error = e.what();
+                    }
+                }
+
+                const auto total = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - job.start);
+                std::stringstream report;
+                report << "status=" << (job.error ? "failed" : "done") << "\n";
+                if (job.error) {
+                    BOOST_LOG_TRIVIAL(error) << "Job " << job.job.name << " failed: " << *job.error;
+                    report << "error=" << *job.error << "\n";
+                } else {
+                    BOOST_LOG_TRIVIAL(info) << "Job " << job.job.name << " done in " << total.count() << " ms";
+                    report << "proof=" << job.job.proof_file_path.string() << "\n";
+                    report << "public-data-reused=" << (reused ? "true" : "false") << "\n";
+                }
+                job.timings.print(report);
+                report << "total-ms=" << total.count() << "\n";
+                spool_.finish_job(job.job.name, report.str());
+            }
+
+            ProverType& prover_;
+            const std::string circuit_name_;
+            const detail::spool_directory spool_;
+            const std::chrono::milliseconds poll_interval_;
+            std::optional<AssignmentTable> preset_table_;
+            std::optional<TableDescription> preset_table_description_;
+            detail::bounded_queue<loaded_job> loaded_jobs_;
+        };
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_PROVER_DAEMON_HPP
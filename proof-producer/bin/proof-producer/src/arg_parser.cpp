@@ -74,7 +74,7 @@ namespace nil {
             // clang-format off
             auto options_appender = config.add_options()
                 ("stage", make_defaulted_option(prover_options.stage),
-                 "Stage of the prover to run, one of (all, preprocess, prove, verify, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks). Defaults to 'all'.")
+                 "Stage of the prover to run, one of (all, preprocess, prove, verify, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks, merge-proofs, daemon, aggregate). Defaults to 'all'.")
                 ("proof,p", make_defaulted_option(prover_options.proof_file_path), "Proof file")
                 ("json,j", make_defaulted_option(prover_options.json_file_path), "JSON proof file")
                 ("common-data", make_defaulted_option(prover_options.preprocessed_common_data_path), "Preprocessed common data file")
@@ -118,7 +118,13 @@ namespace nil {
                  "Aggregated FRI proof part of the final proof. Used with 'merge-proofs' stage.")
                 ("input-combined-Q-polynomial-files", po::value<std::vector<boost::filesystem::path>>(&prover_options.input_combined_Q_polynomial_files),
                  "Files containing polynomials combined-Q, 1 per prover instance.")
-                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.");
+                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.")
+                ("spool-dir", po::value<boost::filesystem::path>(&prover_options.spool_dir_path),
+                 "Directory the prover takes jobs from and writes their reports to. Used with 'daemon' stage.")
+                ("aggregate-circuit", po::value<std::vector<boost::filesystem::path>>(&prover_options.aggregated_circuit_files)->multitoken(),
+                 "Circuits to prove together. Used with 'aggregate' stage.")
+                ("aggregate-assignment-table", po::value<std::vector<boost::filesystem::path>>(&prover_options.aggregated_assignment_table_files)->multitoken(),
+                 "Assignment tables, one for each circuit in the same order. Used with 'aggregate' stage.");
 
             register_output_artifacts_cli_args(prover_options.output_artifacts, config);
         
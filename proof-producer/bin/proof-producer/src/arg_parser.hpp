@@ -63,6 +63,9 @@ namespace nil {
             std::size_t combined_Q_starting_power;
             std::vector<boost::filesystem::path> input_combined_Q_polynomial_files;
             boost::filesystem::path proof_of_work_output_file = "proof_of_work.dat";
+            boost::filesystem::path spool_dir_path;
+            std::vector<boost::filesystem::path> aggregated_circuit_files;
+            std::vector<boost::filesystem::path> aggregated_assignment_table_files;
             boost::log::trivial::severity_level log_level = boost::log::trivial::severity_level::info;
             CurvesVariant elliptic_curve_type = type_identity<nil::crypto3::algebra::curves::pallas>{};
             HashesVariant hash_type = type_identity<nil::crypto3::hashes::keccak_1600<256>>{};
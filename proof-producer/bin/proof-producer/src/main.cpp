@@ -23,7 +23,9 @@
 
 #include <arg_parser.hpp>
 #include <nil/proof-generator/file_operations.hpp>
+#include <nil/proof-generator/aggregated_prover.hpp>
 #include <nil/proof-generator/prover.hpp>
+#include <nil/proof-generator/prover_daemon.hpp>
 
 #undef B0
 
@@ -187,6 +189,29 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             prover_options.proof_file_path
                             );
                     break;
+                case nil::proof_generator::detail::ProverStage::DAEMON:
+                    // The circuit is either read from file, then jobs should bring assignment tables,
+                    // or created by preset, then jobs may also bring traces.
+                    prover_result =
+                        (prover_options.circuit_file_path.empty() ?
+                            prover.setup_prover() :
+                            prover.read_circuit(prover_options.circuit_file_path)) &&
+                        ProverDaemon<CurveType, HashType>(
+                            prover, prover_options.circuit_name, prover_options.spool_dir_path).run();
+                    break;
+                case nil::proof_generator::detail::ProverStage::AGGREGATE:
+                    prover_result =
+                        AggregatedProver<CurveType, HashType>(
+                            prover_options.lambda,
+                            prover_options.expand_factor,
+                            prover_options.max_quotient_chunks,
+                            prover_options.grind,
+                            prover_options.circuit_name
+                        ).generate_to_file(
+                            prover_options.aggregated_circuit_files,
+                            prover_options.aggregated_assignment_table_files,
+                            prover_options.proof_file_path);
+                    break;
             }
         } catch (const std::exception& e) {
             BOOST_LOG_TRIVIAL(error) << e.what();
@@ -24,16 +24,18 @@ namespace nil {
             typename nil::blueprint::bbf::context<BlueprintFieldType, nil::blueprint::bbf::GenerationStage::ASSIGNMENT> context_object(assignment_table, limits::max_rows);
 
             typename ComponentType::input_type input;
-            const auto contract_bytecodes = deserialize_bytecodes_from_file(trace_file_path);
-            if (!contract_bytecodes) {
+            const auto trace = load_execution_trace_from_file(trace_file_path, trace_parts::bytecodes);
+            if (!trace) {
                 return "can't read bytecode trace from file";
             }
 
-            for (const auto& bytecode_it : contract_bytecodes.value()) {
+            for (const auto& bytecode_it : trace->contract_bytecodes) {
                 const auto raw_bytecode = string_to_bytes(bytecode_it.second);
                 input.bytecodes.new_buffer(raw_bytecode);
                 input.keccak_buffers.new_buffer(raw_bytecode);
             }
+            input.bytecodes.finalize();
+            input.keccak_buffers.finalize();
 
             auto start = std::chrono::high_resolution_clock::now();
             ComponentType instance(context_object, input, limits::max_bytecode_size, limits::max_keccak_blocks);
@@ -29,35 +29,22 @@ namespace nil {
             typename ComponentType::input_type input;
             input.rlc_challenge = limits::RLC_CHALLENGE;
             
-            auto copy_events = deserialize_copy_events_from_file(trace_file_path);
-            if (!copy_events) {
-                return "can't read copy events from file";
+            auto trace = load_execution_trace_from_file(trace_file_path,
+                trace_parts::copy_events | trace_parts::bytecodes | trace_parts::rw_operations);
+            if (!trace) {
+                return "can't read copy events, bytecode or rw operations trace from file";
             }
-            input.copy_events = std::move(copy_events.value());
+            input.copy_events = std::move(trace->copy_events);
 
-            const auto contract_bytecodes = deserialize_bytecodes_from_file(trace_file_path);
-            if (!contract_bytecodes) {
-                return "can't read bytecode trace from file";
-            }
-            for (const auto& bytecode_it : contract_bytecodes.value()) {
+            for (const auto& bytecode_it : trace->contract_bytecodes) {
                 const auto raw_bytecode = string_to_bytes(bytecode_it.second);
                 input.bytecodes.new_buffer(raw_bytecode);
                 input.keccak_buffers.new_buffer(raw_bytecode);
             }
+            input.bytecodes.finalize();
+            input.keccak_buffers.finalize();
 
-            const auto rw_operations = deserialize_rw_traces_from_file(trace_file_path);
-            if (!rw_operations) {
-                return "can't read rw operations trace from file";
-            }
-            for (const auto& stack_op : rw_operations->stack_ops) {
-                input.rw_operations.push_back(stack_op);
-            }
-            for (const auto& memory_op : rw_operations->memory_ops) {
-                input.rw_operations.push_back(memory_op);
-            }
-            for (const auto& storage_op : rw_operations->storage_ops) {
-                input.rw_operations.push_back(storage_op);
-            }
+            input.rw_operations = std::move(trace->rw_operations);
 
 
             auto start = std::chrono::high_resolution_clock::now();
@@ -24,26 +24,19 @@ namespace nil {
 
             typename nil::blueprint::bbf::context<BlueprintFieldType, nil::blueprint::bbf::GenerationStage::ASSIGNMENT> context_object(assignment_table, limits::max_rows);
 
-            nil::blueprint::bbf::rw_operations_vector input;
-            const auto rw_operations = deserialize_rw_traces_from_file(trace_file_path);
-            if (!rw_operations) {
+            auto trace = load_execution_trace_from_file(trace_file_path, trace_parts::rw_operations);
+            if (!trace) {
                 return "can't read rw from file";
             }
-            for (const auto& stack_op : rw_operations->stack_ops) {
-                input.push_back(stack_op);
-            }
-            for (const auto& memory_op : rw_operations->memory_ops) {
-                input.push_back(memory_op);
-            }
-            for (const auto& storage_op : rw_operations->storage_ops) {
-                input.push_back(storage_op);
-            }
+            nil::blueprint::bbf::rw_operations_vector input = std::move(trace->rw_operations);
             BOOST_LOG_TRIVIAL(debug) << "number RW operations " << input.size() << ":\n"
-             << "stack   " << rw_operations->stack_ops.size() << "\n"
-             << "memory  " << rw_operations->memory_ops.size() << "\n"
-             << "storage " << rw_operations->storage_ops.size() << "\n";
+             << "stack   " << trace->stack_ops_amount << "\n"
+             << "memory  " << trace->memory_ops_amount << "\n"
+             << "storage " << trace->storage_ops_amount << "\n";
 
             auto start = std::chrono::high_resolution_clock::now();
+            // The circuit expects operations ordered by rw_operation::operator<, the trace is only grouped by type.
+            nil::blueprint::bbf::sort_rw_operations(input);
             ComponentType instance(context_object, std::move(input), limits::max_rw_size, limits::max_mpt_size);
             auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
             std::cout << "FILL ASSIGNMENT TABLE: " << duration.count() << "\n";
@@ -1,13 +1,23 @@
 #ifndef PROOF_GENERATOR_LIBS_ASSIGNER_TRACE_PARSER_HPP_
 #define PROOF_GENERATOR_LIBS_ASSIGNER_TRACE_PARSER_HPP_
 
+#include <algorithm>
+#include <chrono>
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <utility>
 #include <unordered_map>
+#include <sys/resource.h>
 #include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
-#include <boost/filesystem.hpp>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/wire_format_lite.h>
 
 #include <nil/blueprint/zkevm/zkevm_word.hpp>
 #include <nil/blueprint/zkevm_bbf/types/rw_operation.hpp>
@@ -19,12 +29,27 @@
 namespace nil {
     namespace proof_generator {
 
-        struct RWOperations {
-            std::vector<blueprint::bbf::rw_operation> stack_ops;
-            std::vector<blueprint::bbf::rw_operation> memory_ops;
-            std::vector<blueprint::bbf::rw_operation> storage_ops;
+        /// @brief Everything the circuits need from one execution trace file.
+        struct ExecutionTrace {
+            std::unordered_map<std::string, std::string> contract_bytecodes;
+            // Stack, then memory, then storage operations, after the start operation.
+            blueprint::bbf::rw_operations_vector rw_operations;
+            std::size_t stack_ops_amount = 0;
+            std::size_t memory_ops_amount = 0;
+            std::size_t storage_ops_amount = 0;
+            std::vector<blueprint::bbf::zkevm_state> zkevm_states;
+            std::vector<blueprint::bbf::copy_event> copy_events;
         };
 
+        /// @brief Parts of the trace to load, fields which are not requested are skipped without parsing.
+        namespace trace_parts {
+            constexpr std::uint8_t bytecodes = 1 << 0;
+            constexpr std::uint8_t rw_operations = 1 << 1;
+            constexpr std::uint8_t zkevm_states = 1 << 2;
+            constexpr std::uint8_t copy_events = 1 << 3;
+            constexpr std::uint8_t all = bytecodes | rw_operations | zkevm_states | copy_events;
+        } // namespace trace_parts
+
         namespace {
 
             // Convert protobuf Uint256 to zkevm_word_type
@@ -36,24 +61,6 @@ namespace nil {
                 return result;
             }
 
-            [[nodiscard]] std::optional<executionproofs::ExecutionTraces> read_pb_traces_from_file(const boost::filesystem::path& filename) {
-                std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
-                if (!file.is_open()) {
-                    return std::nullopt;
-                }
-                if (!file) {
-                    return std::nullopt;
-                }
-
-                executionproofs::ExecutionTraces pb_traces;
-                if (!pb_traces.ParseFromIstream(&file)) {
-                    return std::nullopt;
-                }
-
-                return pb_traces;
-            }
-
-
             [[nodiscard]] std::optional<std::pair<
                 blueprint::bbf::copy_operand_type,
                 blueprint::zkevm_word_type>
@@ -109,60 +116,32 @@ namespace nil {
             return res;
         }
 
-        [[nodiscard]] std::optional<std::unordered_map<std::string, std::string>> deserialize_bytecodes_from_file(const boost::filesystem::path& filename) {
-            const auto pb_traces = read_pb_traces_from_file(filename);
-            if (!pb_traces) {
-                return std::nullopt;
-            }
-
-            // Read executed op codes
-            std::unordered_map<std::string, std::string> contract_bytecodes;
-            const auto& bytecodes = pb_traces->contract_bytecodes();
-            for (const auto& bytecode : bytecodes) {
-                contract_bytecodes.emplace(bytecode.first, bytecode.second);
-            }
-
-            return contract_bytecodes;
-        }
-
-        [[nodiscard]] std::optional<RWOperations> deserialize_rw_traces_from_file(const boost::filesystem::path& filename) {
-            const auto pb_traces = read_pb_traces_from_file(filename);
-            if (!pb_traces) {
-                return std::nullopt;
-            }
-
-            RWOperations rw_traces;
+        namespace {
 
-            // Convert stack operations
-            rw_traces.stack_ops.reserve(pb_traces->stack_ops_size());
-            for (const auto& pb_sop : pb_traces->stack_ops()) {
-                rw_traces.stack_ops.push_back(blueprint::bbf::stack_rw_operation(
+            [[nodiscard]] blueprint::bbf::rw_operation stack_op_from_proto(const executionproofs::StackOp& pb_sop) {
+                return blueprint::bbf::stack_rw_operation(
                     static_cast<uint64_t>(pb_sop.msg_id()),
                     static_cast<int32_t>(pb_sop.index()),
                     static_cast<uint64_t>(pb_sop.rw_idx()),
                     !pb_sop.is_read(),
-                    proto_uint256_to_zkevm_word(pb_sop.value()))
+                    proto_uint256_to_zkevm_word(pb_sop.value())
                 );
             }
 
-            // Convert memory operations
-            rw_traces.memory_ops.reserve(pb_traces->memory_ops_size());
-            for (const auto& pb_mop : pb_traces->memory_ops()) {
+            [[nodiscard]] blueprint::bbf::rw_operation memory_op_from_proto(const executionproofs::MemoryOp& pb_mop) {
                 auto const value = string_to_bytes(pb_mop.value());
-                auto const op = blueprint::bbf::memory_rw_operation(
+                return blueprint::bbf::memory_rw_operation(
                     static_cast<uint64_t>(pb_mop.msg_id()),
                     blueprint::zkevm_word_type(static_cast<int>(pb_mop.index())),
                     static_cast<uint64_t>(pb_mop.rw_idx()),
                     !pb_mop.is_read(),
                     blueprint::zkevm_word_from_bytes(value)
                 );
-                rw_traces.memory_ops.push_back(op);
             }
 
-            // Convert storage operations
-            rw_traces.storage_ops.reserve(pb_traces->storage_ops_size());
-            for (const auto& pb_sop : pb_traces->storage_ops()) {
-                const auto& op = blueprint::bbf::storage_rw_operation(
+            [[nodiscard]] blueprint::bbf::rw_operation storage_op_from_proto(const executionproofs::StorageOp& pb_sop) {
+                //TODO root and initial_root?
+                return blueprint::bbf::storage_rw_operation(
                     static_cast<uint64_t>(pb_sop.msg_id()),
                     blueprint::zkevm_word_from_string(static_cast<std::string>(pb_sop.key())),
                     static_cast<uint64_t>(pb_sop.rw_idx()),
@@ -171,64 +150,170 @@ namespace nil {
                     proto_uint256_to_zkevm_word(pb_sop.initial_value()),
                     blueprint::zkevm_word_from_string(pb_sop.address().address_bytes())
                 );
-                //TODO root and initial_root?
-                rw_traces.storage_ops.push_back(std::move(op));
             }
 
-            return rw_traces;
-        }
+            // Any opcode reads at most the 17 top stack elements (SWAP16), the deeper ones stay as they were.
+            constexpr std::size_t max_touched_stack_depth = 17;
 
-        [[nodiscard]] std::optional<std::vector<blueprint::bbf::zkevm_state>> deserialize_zkevm_state_traces_from_file(const boost::filesystem::path& filename) {
-            const auto pb_traces = read_pb_traces_from_file(filename);
-            if (!pb_traces) {
-                return std::nullopt;
+            [[nodiscard]] std::optional<std::size_t> zkevm_word_to_size(const blueprint::zkevm_word_type& word) {
+                const blueprint::zkevm_word_integral_type value(word);
+                if ((value >> 64) != 0) {
+                    return std::nullopt;
+                }
+                return static_cast<std::size_t>(value);
             }
 
-            std::vector<blueprint::bbf::zkevm_state> zkevm_states;
-            zkevm_states.reserve(pb_traces->zkevm_states_size());
-            for (const auto& pb_state : pb_traces->zkevm_states()) {
-                std::vector<blueprint::zkevm_word_type> stack;
-                stack.reserve(pb_state.stack_slice_size());
-                for (const auto& pb_stack_val : pb_state.stack_slice()) {
-                    stack.push_back(proto_uint256_to_zkevm_word(pb_stack_val));
+            /// @brief Whether the state continues the call of the previous one, right after its opcode. Calls,
+            /// creates, returns and errors switch to another call, where the stack and the memory are different.
+            [[nodiscard]] bool continues_call(const blueprint::bbf::zkevm_state& previous_state,
+                                              const executionproofs::ZKEVMState& pb_state) {
+                if (previous_state.call_id != pb_state.call_id()) {
+                    return false;
+                }
+                switch (previous_state.opcode) {
+                    case 0x00:  // STOP
+                    case 0xf0:  // CREATE
+                    case 0xf1:  // CALL
+                    case 0xf2:  // CALLCODE
+                    case 0xf3:  // RETURN
+                    case 0xf4:  // DELEGATECALL
+                    case 0xf5:  // CREATE2
+                    case 0xfa:  // STATICCALL
+                    case 0xfd:  // REVERT
+                    case 0xfe:  // INVALID
+                    case 0xff:  // SELFDESTRUCT
+                        return false;
+                    default:
+                        // Errors have numbers past 0xff.
+                        return previous_state.opcode <= 0xff;
                 }
-                std::map<std::size_t, std::uint8_t> memory;
-                for (const auto& pb_memory_val : pb_state.memory_slice()) {
-                    memory.emplace(pb_memory_val.first, pb_memory_val.second);
+            }
+
+            /// @brief Memory range {offset, length} written in its own call by the opcode of the state, taken from
+            /// the stack before the opcode. Returns nullopt if the range does not fit into size_t.
+            [[nodiscard]] std::optional<std::pair<std::size_t, std::size_t>> written_memory_range(
+                    const blueprint::bbf::zkevm_state& state) {
+                std::size_t offset_depth = 0;
+                std::size_t length_depth = 0;
+                std::size_t fixed_length = 0;
+                switch (state.opcode) {
+                    case 0x52:  // MSTORE
+                        fixed_length = 32;
+                        break;
+                    case 0x53:  // MSTORE8
+                        fixed_length = 1;
+                        break;
+                    case 0x37:  // CALLDATACOPY
+                    case 0x39:  // CODECOPY
+                    case 0x3e:  // RETURNDATACOPY
+                    case 0x5e:  // MCOPY
+                        length_depth = 2;
+                        break;
+                    case 0x3c:  // EXTCODECOPY
+                        offset_depth = 1;
+                        length_depth = 3;
+                        break;
+                    default:
+                        return std::make_pair(std::size_t(0), std::size_t(0));
+                }
+                if (std::max(offset_depth, length_depth) >= state.stack_slice.size()) {
+                    return std::nullopt;
                 }
-                std::map<blueprint::zkevm_word_type, blueprint::zkevm_word_type> storage;
-                for (const auto& pb_storage_entry : pb_state.storage_slice()) {
-                    storage.emplace(proto_uint256_to_zkevm_word(pb_storage_entry.key()), proto_uint256_to_zkevm_word(pb_storage_entry.value()));
+                const std::optional<std::size_t> length =
+                    fixed_length != 0 ? fixed_length : zkevm_word_to_size(state.stack_top(length_depth));
+                if (length == 0) {
+                    return std::make_pair(std::size_t(0), std::size_t(0));
                 }
-                zkevm_states.emplace_back(stack, memory, storage);
-                zkevm_states.back().call_id = static_cast<uint64_t>(pb_state.call_id());
-                zkevm_states.back().pc = static_cast<uint64_t>(pb_state.pc());
-                zkevm_states.back().gas = static_cast<uint64_t>(pb_state.gas());
-                zkevm_states.back().rw_counter = static_cast<uint64_t>(pb_state.rw_idx());
-                zkevm_states.back().bytecode_hash = blueprint::zkevm_word_from_string(static_cast<std::string>(pb_state.bytecode_hash()));
-                zkevm_states.back().opcode = static_cast<uint64_t>(pb_state.opcode());
-                zkevm_states.back().additional_input = proto_uint256_to_zkevm_word(pb_state.additional_input()),
-                zkevm_states.back().stack_size = static_cast<uint64_t>(pb_state.stack_size());
-                zkevm_states.back().memory_size = static_cast<uint64_t>(pb_state.memory_size());
-                zkevm_states.back().tx_finish = static_cast<bool>(pb_state.tx_finish());
-                zkevm_states.back().error_opcode = static_cast<uint64_t>(pb_state.error_opcode());
+                const std::optional<std::size_t> offset = zkevm_word_to_size(state.stack_top(offset_depth));
+                if (!offset || !length) {
+                    return std::nullopt;
+                }
+                return std::make_pair(*offset, *length);
             }
 
-            return zkevm_states;
-        }
+            /// @brief Converts the state, sharing the slices with the previous state of the same call.
+            ///
+            /// Consecutive states of a call differ only in what the opcode of the previous state changed: a few top
+            /// stack elements, the memory range it writes and the storage slot it loads or stores. Only these are
+            /// set in the slices copied from the previous state, the other pages stay shared. The first state of
+            /// a call, and a state after an opcode whose effect is not clear from the trace, is built anew.
+            [[nodiscard]] blueprint::bbf::zkevm_state zkevm_state_from_proto(const executionproofs::ZKEVMState& pb_state,
+                                                                              const blueprint::bbf::zkevm_state* previous_state) {
+                blueprint::bbf::zkevm_state state;
+                const bool same_call = previous_state != nullptr && continues_call(*previous_state, pb_state);
+
+                // Slices are updated in place if both states hold the whole stack or memory, only the top of the stack
+                // and the memory written by the previous opcode are set.
+                const std::size_t stack_size = pb_state.stack_slice_size();
+                std::size_t kept_stack_size = 0;
+                if (same_call && stack_size == pb_state.stack_size() &&
+                    previous_state->stack_slice.size() == previous_state->stack_size) {
+                    const std::size_t previous_stack_size = previous_state->stack_slice.size();
+                    state.stack_slice = previous_state->stack_slice;
+                    if (previous_stack_size > max_touched_stack_depth) {
+                        kept_stack_size = std::min(stack_size, previous_stack_size - max_touched_stack_depth);
+                    }
+                }
+                state.stack_slice.resize(stack_size);
+                for (std::size_t i = kept_stack_size; i < stack_size; i++) {
+                    state.stack_slice.set(i, proto_uint256_to_zkevm_word(pb_state.stack_slice(i)));
+                }
 
-        [[nodiscard]] std::optional<std::vector<blueprint::bbf::copy_event>> deserialize_copy_events_from_file(const boost::filesystem::path& filename) {
-            const auto pb_traces = read_pb_traces_from_file(filename);
-            if (!pb_traces) {
-                return std::nullopt;
-            }
+                // A write past the memory means the opcode failed, the memory is taken as it is then.
+                const auto& pb_memory = pb_state.memory_slice();
+                const std::size_t memory_size = pb_memory.size();
+                std::optional<std::pair<std::size_t, std::size_t>> written;
+                if (same_call && memory_size == pb_state.memory_size() &&
+                    previous_state->memory_slice.size() == previous_state->memory_size) {
+                    written = written_memory_range(*previous_state);
+                }
+                if (written && written->second <= memory_size && written->first <= memory_size - written->second) {
+                    state.memory_slice = previous_state->memory_slice;
+                    state.memory_slice.resize(memory_size);
+                    for (std::size_t addr = written->first; addr < written->first + written->second; addr++) {
+                        const auto it = pb_memory.find(addr);
+                        state.memory_slice.set(addr, it == pb_memory.end() ? 0 : static_cast<std::uint8_t>(it->second));
+                    }
+                } else {
+                    std::size_t memory_end = 0;
+                    for (const auto& pb_memory_val : pb_memory) {
+                        memory_end = std::max<std::size_t>(memory_end, pb_memory_val.first + 1);
+                    }
+                    state.memory_slice.resize(memory_end);
+                    for (const auto& pb_memory_val : pb_memory) {
+                        state.memory_slice.set(pb_memory_val.first, static_cast<std::uint8_t>(pb_memory_val.second));
+                    }
+                }
 
-            namespace bbf = blueprint::bbf;
+                // Only SLOAD and SSTORE change the storage of a call.
+                if (same_call) {
+                    state.storage_slice = previous_state->storage_slice;
+                }
+                if (!same_call || previous_state->opcode == 0x54 || previous_state->opcode == 0x55 ||
+                    state.storage_slice.size() != static_cast<std::size_t>(pb_state.storage_slice_size())) {
+                    std::map<blueprint::zkevm_word_type, blueprint::zkevm_word_type> storage;
+                    for (const auto& pb_storage_entry : pb_state.storage_slice()) {
+                        storage.emplace(proto_uint256_to_zkevm_word(pb_storage_entry.key()), proto_uint256_to_zkevm_word(pb_storage_entry.value()));
+                    }
+                    state.storage_slice.assign(storage);
+                }
+
+                state.call_id = static_cast<uint64_t>(pb_state.call_id());
+                state.pc = static_cast<uint64_t>(pb_state.pc());
+                state.gas = static_cast<uint64_t>(pb_state.gas());
+                state.rw_counter = static_cast<uint64_t>(pb_state.rw_idx());
+                state.bytecode_hash = blueprint::zkevm_word_from_string(static_cast<std::string>(pb_state.bytecode_hash()));
+                state.opcode = static_cast<uint64_t>(pb_state.opcode());
+                state.additional_input = proto_uint256_to_zkevm_word(pb_state.additional_input());
+                state.stack_size = static_cast<uint64_t>(pb_state.stack_size());
+                state.memory_size = static_cast<uint64_t>(pb_state.memory_size());
+                state.tx_finish = static_cast<bool>(pb_state.tx_finish());
+                state.error_opcode = static_cast<uint64_t>(pb_state.error_opcode());
+                return state;
+            }
 
-            std::vector<bbf::copy_event> copy_events;
-            copy_events.reserve(pb_traces->copy_events_size());
-            for (const auto& pb_event: pb_traces->copy_events()) {
-                bbf::copy_event event;
+            [[nodiscard]] std::optional<blueprint::bbf::copy_event> copy_event_from_proto(const executionproofs::CopyEvent& pb_event) {
+                blueprint::bbf::copy_event event;
                 event.initial_rw_counter = pb_event.rw_idx();
 
                 const auto source = copy_operand_from_proto(pb_event.from());
@@ -247,13 +332,193 @@ namespace nil {
                 event.destination_id = dest->second;
                 event.dst_address = pb_event.to().mem_address();
 
-                event.bytes = std::move(string_to_bytes(pb_event.data()));
+                event.bytes = string_to_bytes(pb_event.data());
                 event.length = event.bytes.size();
+                return event;
+            }
+
+            // Parses one length-delimited submessage at the current position of the stream into message.
+            template<typename Message>
+            [[nodiscard]] bool read_message(google::protobuf::io::CodedInputStream& input, std::uint32_t length, Message& message) {
+                const auto limit = input.PushLimit(static_cast<int>(length));
+                message.Clear();
+                if (!message.MergeFromCodedStream(&input) || !input.ConsumedEntireMessage()) {
+                    return false;
+                }
+                input.PopLimit(limit);
+                return true;
+            }
+
+            // Map entries are messages with the key in field 1 and the value in field 2.
+            [[nodiscard]] bool read_string_map_entry(google::protobuf::io::CodedInputStream& input, std::uint32_t length,
+                                                     std::string& key, std::string& value) {
+                using google::protobuf::internal::WireFormatLite;
+
+                const auto limit = input.PushLimit(static_cast<int>(length));
+                key.clear();
+                value.clear();
+                while (const std::uint32_t tag = input.ReadTag()) {
+                    bool ok;
+                    if (tag == WireFormatLite::MakeTag(1, WireFormatLite::WIRETYPE_LENGTH_DELIMITED)) {
+                        ok = WireFormatLite::ReadBytes(&input, &key);
+                    } else if (tag == WireFormatLite::MakeTag(2, WireFormatLite::WIRETYPE_LENGTH_DELIMITED)) {
+                        ok = WireFormatLite::ReadBytes(&input, &value);
+                    } else {
+                        ok = WireFormatLite::SkipField(&input, tag);
+                    }
+                    if (!ok) {
+                        return false;
+                    }
+                }
+                if (!input.ConsumedEntireMessage()) {
+                    return false;
+                }
+                input.PopLimit(limit);
+                return true;
+            }
+
+            [[nodiscard]] long peak_rss_kb() {
+                rusage usage{};
+                getrusage(RUSAGE_SELF, &usage);
+                return usage.ru_maxrss;
+            }
+        } // namespace
+
+        /// @brief Reads the requested parts of an ExecutionTraces message in a single pass.
+        ///
+        /// Repeated fields are read one element at a time and converted right away, so the whole protobuf
+        /// message is never held in memory, only the converted data.
+        [[nodiscard]] std::optional<ExecutionTrace> load_execution_trace_from_file(const boost::filesystem::path& filename,
+                                                                                   std::uint8_t parts = trace_parts::all) {
+            using google::protobuf::internal::WireFormatLite;
+
+            std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+            if (!file.is_open() || !file) {
+                return std::nullopt;
+            }
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            const long rss_before = peak_rss_kb();
+
+            google::protobuf::io::IstreamInputStream raw_input(&file);
+            google::protobuf::io::CodedInputStream input(&raw_input);
+
+            ExecutionTrace trace;
+            // Protobuf writes fields in the order of their numbers, so operations come grouped by type, but nothing
+            // forces a writer to do so. If they do not, we restore the stack, memory, storage order at the end.
+            bool rw_in_type_order = true;
+            auto push_rw_operation = [&trace, &rw_in_type_order](blueprint::bbf::rw_operation&& op) {
+                if (op.op < trace.rw_operations.back().op) {
+                    rw_in_type_order = false;
+                }
+                trace.rw_operations.push_back(std::move(op));
+            };
+
+            executionproofs::StackOp pb_stack_op;
+            executionproofs::MemoryOp pb_memory_op;
+            executionproofs::StorageOp pb_storage_op;
+            executionproofs::ZKEVMState pb_state;
+            executionproofs::CopyEvent pb_event;
+            std::string bytecode_hash, bytecode;
+
+            while (const std::uint32_t tag = input.ReadTag()) {
+                const int field = WireFormatLite::GetTagFieldNumber(tag);
+                if (WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+                    if (!WireFormatLite::SkipField(&input, tag)) {
+                        return std::nullopt;
+                    }
+                    continue;
+                }
+                std::uint32_t length;
+                if (!input.ReadVarint32(&length)) {
+                    return std::nullopt;
+                }
+
+                bool ok = true;
+                switch (field) {
+                    case executionproofs::ExecutionTraces::kStackOpsFieldNumber:
+                        if (!(parts & trace_parts::rw_operations)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_message(input, length, pb_stack_op))) {
+                            push_rw_operation(stack_op_from_proto(pb_stack_op));
+                            trace.stack_ops_amount++;
+                        }
+                        break;
+                    case executionproofs::ExecutionTraces::kMemoryOpsFieldNumber:
+                        if (!(parts & trace_parts::rw_operations)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_message(input, length, pb_memory_op))) {
+                            push_rw_operation(memory_op_from_proto(pb_memory_op));
+                            trace.memory_ops_amount++;
+                        }
+                        break;
+                    case executionproofs::ExecutionTraces::kStorageOpsFieldNumber:
+                        if (!(parts & trace_parts::rw_operations)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_message(input, length, pb_storage_op))) {
+                            push_rw_operation(storage_op_from_proto(pb_storage_op));
+                            trace.storage_ops_amount++;
+                        }
+                        break;
+                    case executionproofs::ExecutionTraces::kContractBytecodesFieldNumber:
+                        if (!(parts & trace_parts::bytecodes)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_string_map_entry(input, length, bytecode_hash, bytecode))) {
+                            trace.contract_bytecodes.emplace(std::move(bytecode_hash), std::move(bytecode));
+                        }
+                        break;
+                    case executionproofs::ExecutionTraces::kZkevmStatesFieldNumber:
+                        if (!(parts & trace_parts::zkevm_states)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_message(input, length, pb_state))) {
+                            trace.zkevm_states.push_back(zkevm_state_from_proto(
+                                pb_state, trace.zkevm_states.empty() ? nullptr : &trace.zkevm_states.back()));
+                        }
+                        break;
+                    case executionproofs::ExecutionTraces::kCopyEventsFieldNumber:
+                        if (!(parts & trace_parts::copy_events)) {
+                            ok = input.Skip(length);
+                        } else if ((ok = read_message(input, length, pb_event))) {
+                            auto event = copy_event_from_proto(pb_event);
+                            if (!event) {
+                                return std::nullopt;
+                            }
+                            trace.copy_events.push_back(std::move(event.value()));
+                        }
+                        break;
+                    default:
+                        // message_traces and fields unknown to this version of the format.
+                        ok = input.Skip(length);
+                        break;
+                }
+                if (!ok) {
+                    return std::nullopt;
+                }
+            }
+            if (!input.ConsumedEntireMessage()) {
+                return std::nullopt;
+            }
 
-                copy_events.push_back(std::move(event));
+            if (!rw_in_type_order) {
+                std::stable_sort(trace.rw_operations.begin(), trace.rw_operations.end(),
+                                 [](const blueprint::bbf::rw_operation& a, const blueprint::bbf::rw_operation& b) {
+                                     return a.op < b.op;
+                                 });
             }
 
-            return copy_events;
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now() - start);
+            BOOST_LOG_TRIVIAL(info) << "Trace " << filename << " loaded in " << duration.count() << " ms, "
+                                    << "peak memory " << peak_rss_kb() / 1024 << " MB "
+                                    << "(+" << (peak_rss_kb() - rss_before) / 1024 << " MB)";
+            BOOST_LOG_TRIVIAL(debug) << "bytecodes " << trace.contract_bytecodes.size() << "\n"
+                                     << "stack   " << trace.stack_ops_amount << "\n"
+                                     << "memory  " << trace.memory_ops_amount << "\n"
+                                     << "storage " << trace.storage_ops_amount << "\n"
+                                     << "states  " << trace.zkevm_states.size() << "\n"
+                                     << "copy    " << trace.copy_events.size() << "\n";
+
+            return trace;
         }
     } // namespace proof_generator
 } // namespace nil
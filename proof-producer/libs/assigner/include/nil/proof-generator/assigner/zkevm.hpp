@@ -26,45 +26,27 @@ namespace nil {
 
             typename ComponentType::input_type input;
 
-            // bytecode
-            const auto contract_bytecodes = deserialize_bytecodes_from_file(trace_file_path);
-            if (!contract_bytecodes) {
-                return "can't read bytecode from file";
+            auto trace = load_execution_trace_from_file(trace_file_path, trace_parts::all);
+            if (!trace) {
+                return "can't read zkevm trace from file";
             }
-            for (const auto& bytecode_it : contract_bytecodes.value()) {
+
+            // bytecode
+            for (const auto& bytecode_it : trace->contract_bytecodes) {
                 const auto raw_bytecode = string_to_bytes(bytecode_it.second);
                 input.bytecodes.new_buffer(raw_bytecode);
                 input.keccak_buffers.new_buffer(raw_bytecode);
             }
+            input.bytecodes.finalize();
+            input.keccak_buffers.finalize();
 
             // rw
-            const auto rw_operations = deserialize_rw_traces_from_file(trace_file_path);
-            if (!rw_operations) {
-                return "can't read rw from file";
-            }
-            for (const auto& stack_op : rw_operations->stack_ops) {
-                input.rw_operations.push_back(stack_op);
-            }
-            for (const auto& memory_op : rw_operations->memory_ops) {
-                input.rw_operations.push_back(memory_op);
-            }
-            for (const auto& storage_op : rw_operations->storage_ops) {
-                input.rw_operations.push_back(storage_op);
-            }
+            input.rw_operations = std::move(trace->rw_operations);
 
-            
             // states
-            const auto zkevm_states = deserialize_zkevm_state_traces_from_file(trace_file_path);
-            if (!zkevm_states) {
-                return "can't read zkevm states from file";
-            }
-            input.zkevm_states = zkevm_states.value();
+            input.zkevm_states = std::move(trace->zkevm_states);
 
-            const auto copy_events = deserialize_copy_events_from_file(trace_file_path);
-            if (!copy_events) {
-                return "can't read copy events from file";
-            }
-            input.copy_events = copy_events.value();
+            input.copy_events = std::move(trace->copy_events);
 
             auto start = std::chrono::high_resolution_clock::now();
             ComponentType instance(
@@ -107,13 +107,10 @@ namespace nil {
             public:
                 assignment_table_writer() = delete;
 
-                static void write_binary_assignment(std::ostream& out, const AssignmentTable& table, const AssignmentTableDescription& desc) {
-                    std::uint32_t public_input_size = table.public_inputs_amount();
-                    std::uint32_t witness_size = table.witnesses_amount();
-                    std::uint32_t constant_size = table.constants_amount();
-                    std::uint32_t selector_size = table.selectors_amount();
-                    std::uint32_t usable_rows_amount = desc.usable_rows_amount;
-
+                /**
+                * @brief Number of rows the table is padded to in the written file.
+                */
+                static std::uint32_t padded_rows_amount(std::uint32_t usable_rows_amount) {
                     std::uint32_t padded_rows_amount = std::pow(2, std::ceil(std::log2(usable_rows_amount)));
                     if (padded_rows_amount == usable_rows_amount) {
                         padded_rows_amount *= 2;
@@ -121,7 +118,17 @@ namespace nil {
                     if (padded_rows_amount < 8) {
                         padded_rows_amount = 8;
                     }
-                    
+                    return padded_rows_amount;
+                }
+
+                static void write_binary_assignment(std::ostream& out, const AssignmentTable& table, const AssignmentTableDescription& desc) {
+                    std::uint32_t public_input_size = table.public_inputs_amount();
+                    std::uint32_t witness_size = table.witnesses_amount();
+                    std::uint32_t constant_size = table.constants_amount();
+                    std::uint32_t selector_size = table.selectors_amount();
+                    std::uint32_t usable_rows_amount = desc.usable_rows_amount;
+                    std::uint32_t padded_rows_amount = assignment_table_writer::padded_rows_amount(usable_rows_amount);
+
                     write_size_t(out, witness_size);
                     write_size_t(out, public_input_size);
                     write_size_t(out, constant_size);
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/aggregated_prover.hpp>
+#include <nil/proof-generator/prover.hpp>
+
+class AggregatedProverTests: public ::testing::Test {
+    protected:
+        using CurveType = nil::crypto3::algebra::curves::pallas;
+        using HashType = nil::crypto3::hashes::keccak_1600<256>;
+        using ProverType = nil::proof_generator::Prover<CurveType, HashType>;
+        using AggregatedProverType = nil::proof_generator::AggregatedProver<CurveType, HashType>;
+
+        static constexpr std::size_t lambda = 9;
+        static constexpr std::size_t grind = 0;
+        static constexpr std::size_t expand_factor = 2;
+        static constexpr std::size_t max_quotient_chunks = 0;
+
+        void SetUp() override {
+            dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("aggregate-%%%%-%%%%");
+            boost::filesystem::create_directories(dir);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir);
+        }
+
+        ProverType make_prover(const std::string& circuit_name = "") const {
+            return ProverType(lambda, expand_factor, max_quotient_chunks, grind, circuit_name);
+        }
+
+        // Writes the circuit and the assignment table of the given circuit, as the preset and assignment stages do.
+        void write_circuit(const std::string& circuit_name) {
+            ProverType prover = make_prover(circuit_name);
+            ASSERT_TRUE(prover.setup_prover());
+            ASSERT_TRUE(prover.fill_assignment_table(std::string(TEST_DATA_DIR) + "increment_multi_tx.pb"));
+            circuit_files.push_back(dir / (circuit_name + ".crct"));
+            table_files.push_back(dir / (circuit_name + ".tbl"));
+            ASSERT_TRUE(prover.save_circuit_to_file(circuit_files.back()));
+            ASSERT_TRUE(prover.save_binary_assignment_table_to_file(table_files.back()));
+        }
+
+        static std::vector<char> read_file(const boost::filesystem::path& path) {
+            std::ifstream in(path.string(), std::ios::binary);
+            return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        boost::filesystem::path dir;
+        std::vector<boost::filesystem::path> circuit_files;
+        std::vector<boost::filesystem::path> table_files;
+};
+
+TEST_F(AggregatedProverTests, RejectMismatchedInputs) {
+    AggregatedProverType aggregated_prover(lambda, expand_factor, max_quotient_chunks, grind, "");
+    EXPECT_FALSE(aggregated_prover.generate_to_file({}, {}, dir / "merged_proof.bin"));
+    EXPECT_FALSE(aggregated_prover.generate_to_file({dir / "a.crct"}, {}, dir / "merged_proof.bin"));
+    EXPECT_FALSE(boost::filesystem::exists(dir / "merged_proof.bin"));
+}
+
+// There is no verifier for aggregated proofs yet, so the aggregate stage is checked against the proof produced
+// by the stages generate-partial-proof ... merge-proofs run one after another.
+TEST_F(AggregatedProverTests, MatchesStagedProof) {
+    write_circuit(nil::proof_generator::circuits::COPY);
+    write_circuit(nil::proof_generator::circuits::BYTECODE);
+    const std::size_t provers_amount = circuit_files.size();
+
+    const boost::filesystem::path aggregated_proof_file = dir / "aggregated_proof.bin";
+    AggregatedProverType aggregated_prover(lambda, expand_factor, max_quotient_chunks, grind, "");
+    ASSERT_TRUE(aggregated_prover.generate_to_file(circuit_files, table_files, aggregated_proof_file));
+    ASSERT_TRUE(boost::filesystem::exists(aggregated_proof_file));
+
+    std::vector<std::optional<ProverType>> provers(provers_amount);
+    std::vector<boost::filesystem::path> partial_proof_files, challenge_files;
+    std::vector<std::size_t> theta_powers;
+    for (std::size_t i = 0; i < provers_amount; ++i) {
+        const std::string index = std::to_string(i);
+        ProverType& prover = provers[i].emplace(make_prover());
+        ASSERT_TRUE(prover.read_circuit(circuit_files[i]));
+        ASSERT_TRUE(prover.read_assignment_table(table_files[i]));
+        ASSERT_TRUE(prover.preprocess_public_data());
+        ASSERT_TRUE(prover.preprocess_private_data());
+        partial_proof_files.push_back(dir / ("partial_proof_" + index + ".bin"));
+        challenge_files.push_back(dir / ("challenge_" + index + ".dat"));
+        ASSERT_TRUE(prover.generate_partial_proof_to_file(
+            partial_proof_files.back(), challenge_files.back(), dir / ("theta_power_" + index + ".txt")));
+        theta_powers.push_back(prover.compute_theta_power_for_combined_Q());
+    }
+
+    const boost::filesystem::path aggregated_challenge_file = dir / "aggregated_challenge.dat";
+    ASSERT_TRUE(make_prover().generate_aggregated_challenge_to_file(challenge_files, aggregated_challenge_file));
+
+    std::vector<boost::filesystem::path> combined_Q_files;
+    std::size_t starting_power = 0;
+    for (std::size_t i = 0; i < provers_amount; ++i) {
+        combined_Q_files.push_back(dir / ("combined_Q_" + std::to_string(i) + ".dat"));
+        ASSERT_TRUE(provers[i]->generate_combined_Q_to_file(
+            aggregated_challenge_file, starting_power, combined_Q_files.back()));
+        starting_power += theta_powers[i];
+    }
+
+    const boost::filesystem::path fri_proof_file = dir / "aggregated_FRI_proof.bin";
+    const boost::filesystem::path consistency_checks_challenges_file = dir / "consistency_checks_challenges.dat";
+    ASSERT_TRUE(provers[0]->generate_aggregated_FRI_proof_to_file(
+        aggregated_challenge_file, combined_Q_files, fri_proof_file, dir / "POW.dat",
+        consistency_checks_challenges_file));
+
+    std::vector<boost::filesystem::path> initial_proof_files;
+    for (std::size_t i = 0; i < provers_amount; ++i) {
+        initial_proof_files.push_back(dir / ("LPC_consistency_check_proof_" + std::to_string(i) + ".bin"));
+        ASSERT_TRUE(provers[i]->generate_consistency_checks_to_file(
+            combined_Q_files[i], consistency_checks_challenges_file, initial_proof_files.back()));
+    }
+
+    const boost::filesystem::path staged_proof_file = dir / "staged_proof.bin";
+    ASSERT_TRUE(provers[0]->merge_proofs(partial_proof_files, initial_proof_files, fri_proof_file, staged_proof_file));
+
+    const std::vector<char> aggregated_proof = read_file(aggregated_proof_file);
+    EXPECT_FALSE(aggregated_proof.empty());
+    EXPECT_EQ(aggregated_proof, read_file(staged_proof_file));
+
+    using MergedProofMarshalling = nil::crypto3::marshalling::types::
+        placeholder_aggregated_proof_type<ProverType::TTypeBase, ProverType::Proof>;
+    const auto marshalled_proof =
+        nil::proof_generator::detail::decode_marshalling_from_file<MergedProofMarshalling>(aggregated_proof_file);
+    ASSERT_TRUE(marshalled_proof.has_value());
+    const auto merged_proof = nil::crypto3::marshalling::types::make_placeholder_aggregated_proof<
+        ProverType::Endianness, ProverType::AggregatedProof, ProverType::Proof>(*marshalled_proof);
+    EXPECT_EQ(merged_proof.partial_proofs.size(), provers_amount);
+    EXPECT_EQ(merged_proof.aggregated_proof.initial_proofs_per_prover.size(), provers_amount);
+}
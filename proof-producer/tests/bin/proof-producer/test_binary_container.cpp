@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/proof-generator/assignment_table_file.hpp>
+#include <nil/proof-generator/binary_container.hpp>
+#include <nil/proof-generator/commitment_state_file.hpp>
+#include <nil/proof-generator/prover.hpp>
+
+using nil::proof_generator::binary_container_alignment;
+using nil::proof_generator::binary_container_writer;
+using nil::proof_generator::mapped_binary_container;
+
+using node_type = std::array<std::uint8_t, 32>;
+
+class BinaryContainerTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("container-%%%%-%%%%.bin");
+
+            values.resize(1000);
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                values[i] = i * i;
+            }
+            nodes.resize(37);
+            for (std::size_t i = 0; i < nodes.size(); ++i) {
+                nodes[i].fill(static_cast<std::uint8_t>(i));
+            }
+
+            binary_container_writer writer(path, content_type, content_version);
+            ASSERT_TRUE(writer.is_open());
+            writer.begin_section(1, 0, 1);
+            writer.write(metadata.data(), 5);
+            writer.write(metadata.data() + 5, metadata.size() - 5);
+            writer.end_section();
+            writer.begin_section(2, 42, sizeof(std::uint64_t));
+            writer.write_array(values.data(), 500);
+            writer.write_array(values.data() + 500, 500);
+            writer.end_section();
+            writer.begin_section(3, 42, sizeof(nodes[0]));
+            writer.write_array(nodes.data(), nodes.size());
+            writer.end_section();
+            ASSERT_TRUE(writer.close());
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove(path);
+        }
+
+        static constexpr std::uint32_t content_type = 7;
+        static constexpr std::uint32_t content_version = 3;
+
+        boost::filesystem::path path;
+        const std::string metadata = "marshalled metadata";
+        std::vector<std::uint64_t> values;
+        std::vector<node_type> nodes;
+};
+
+TEST_F(BinaryContainerTests, ReadSections) {
+    auto container = mapped_binary_container::open(path, content_type, content_version);
+    ASSERT_TRUE(container.has_value());
+    EXPECT_EQ(container->sections().size(), 3);
+
+    const auto* metadata_section = container->find_section(1, 0);
+    ASSERT_NE(metadata_section, nullptr);
+    auto bytes = container->section_bytes(*metadata_section);
+    EXPECT_EQ(std::string(bytes.begin(), bytes.end()), metadata);
+
+    const auto* values_section = container->find_section(2, 42);
+    ASSERT_NE(values_section, nullptr);
+    auto read_values = container->section_array<std::uint64_t>(*values_section);
+    ASSERT_TRUE(read_values.has_value());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(read_values->data()) % binary_container_alignment, 0);
+    EXPECT_EQ(std::vector<std::uint64_t>(read_values->begin(), read_values->end()), values);
+
+    const auto* nodes_section = container->find_section(3, 42);
+    ASSERT_NE(nodes_section, nullptr);
+    auto read_nodes = container->section_array<node_type>(*nodes_section);
+    ASSERT_TRUE(read_nodes.has_value());
+    EXPECT_EQ(std::vector<node_type>(read_nodes->begin(), read_nodes->end()), nodes);
+    // Element size is checked.
+    EXPECT_FALSE(container->section_array<std::uint32_t>(*nodes_section).has_value());
+
+    EXPECT_EQ(container->find_section(2, 43), nullptr);
+}
+
+TEST_F(BinaryContainerTests, RejectsOtherContent) {
+    EXPECT_TRUE(mapped_binary_container::is_binary_container(path));
+    EXPECT_FALSE(mapped_binary_container::open(path, content_type + 1, content_version).has_value());
+    EXPECT_FALSE(mapped_binary_container::open(path, content_type, content_version + 1).has_value());
+}
+
+TEST_F(BinaryContainerTests, DetectsCorruption) {
+    auto container = mapped_binary_container::open(path, content_type, content_version);
+    ASSERT_TRUE(container.has_value());
+    const std::size_t offset = container->find_section(2, 42)->offset + 100;
+    container.reset();
+
+    {
+        std::fstream file(path.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.put(char(0xAB));
+    }
+    EXPECT_FALSE(mapped_binary_container::open(path, content_type, content_version).has_value());
+    // Checksums are optional on open.
+    EXPECT_TRUE(mapped_binary_container::open(path, content_type, content_version, false).has_value());
+}
+
+TEST_F(BinaryContainerTests, DetectsTruncation) {
+    boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(mapped_binary_container::open(path, content_type, content_version).has_value());
+}
+
+TEST(AssignmentTableFileTests, RoundTrip) {
+    using BlueprintField = nil::crypto3::algebra::curves::pallas::base_field_type;
+    using value_type = BlueprintField::value_type;
+    using Column = nil::crypto3::zk::snark::plonk_column<BlueprintField>;
+    using AssignmentTable = nil::crypto3::zk::snark::plonk_assignment_table<BlueprintField>;
+    using TableDescription = nil::crypto3::zk::snark::plonk_table_description<BlueprintField>;
+
+    auto make_column = [](std::size_t size, std::size_t seed) {
+        Column column(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            column[i] = value_type(seed * 1000 + i).pow(3);
+        }
+        return column;
+    };
+    constexpr std::size_t rows_amount = 32;
+    std::vector<Column> witnesses = {make_column(20, 1), make_column(32, 2), make_column(40, 3)};
+    std::vector<Column> public_inputs = {make_column(3, 4)};
+    std::vector<Column> constants = {make_column(0, 5)};
+    std::vector<Column> selectors = {make_column(20, 6), make_column(1, 7)};
+    AssignmentTable table(
+        std::make_shared<AssignmentTable::private_table_type>(witnesses),
+        std::make_shared<AssignmentTable::public_table_type>(public_inputs, constants, selectors));
+    TableDescription desc(3, 1, 1, 2, 20, rows_amount);
+
+    auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("table-%%%%-%%%%.bin");
+    ASSERT_TRUE(nil::proof_generator::write_assignment_table_file<BlueprintField>(path, table, desc, rows_amount));
+    auto read = nil::proof_generator::read_assignment_table_file<BlueprintField>(path);
+    boost::filesystem::remove(path);
+    ASSERT_TRUE(read.has_value());
+
+    const auto& [read_desc, read_table] = *read;
+    EXPECT_EQ(read_desc.witness_columns, 3);
+    EXPECT_EQ(read_desc.public_input_columns, 1);
+    EXPECT_EQ(read_desc.constant_columns, 1);
+    EXPECT_EQ(read_desc.selector_columns, 2);
+    EXPECT_EQ(read_desc.usable_rows_amount, 20);
+    EXPECT_EQ(read_desc.rows_amount, rows_amount);
+
+    // Columns are padded with zeroes or cut to the rows amount.
+    auto expected = [](const Column& column) {
+        Column result(rows_amount, value_type::zero());
+        std::copy(column.begin(), column.begin() + std::min(column.size(), rows_amount), result.begin());
+        return result;
+    };
+    for (std::size_t i = 0; i < witnesses.size(); ++i) {
+        EXPECT_EQ(read_table.witness(i), expected(witnesses[i]));
+    }
+    EXPECT_EQ(read_table.public_input(0), expected(public_inputs[0]));
+    EXPECT_EQ(read_table.constant(0), expected(constants[0]));
+    for (std::size_t i = 0; i < selectors.size(); ++i) {
+        EXPECT_EQ(read_table.selector(i), expected(selectors[i]));
+    }
+}
+
+// A committed LPC state as the prover saves it between the stages: a fixed batch with its values at etha, a second
+// committed batch and evaluation points. The reloaded scheme must produce exactly the same evaluation proof.
+TEST(CommitmentStateFileTests, RoundTrip) {
+    using ProverType = nil::proof_generator::Prover<
+        nil::crypto3::algebra::curves::pallas, nil::crypto3::hashes::keccak_1600<256>>;
+    using Endianness = ProverType::Endianness;
+    using LpcScheme = ProverType::LpcScheme;
+    using polynomial_type = LpcScheme::polynomial_type;
+    using value_type = ProverType::BlueprintField::value_type;
+    using transcript_type = LpcScheme::transcript_type;
+
+    constexpr std::size_t rows_log = 4;
+    constexpr std::size_t rows_amount = 1 << rows_log;
+    auto make_poly = [](std::size_t seed) {
+        std::vector<value_type> values(rows_amount);
+        for (std::size_t i = 0; i < rows_amount; ++i) {
+            values[i] = value_type(seed * 1000 + i).pow(3);
+        }
+        return polynomial_type(rows_amount - 1, values.begin(), values.end());
+    };
+
+    LpcScheme scheme(ProverType::FriParams(1, rows_log, 9, 2));
+    scheme.append_to_batch(0, make_poly(1));
+    scheme.append_to_batch(0, make_poly(2));
+    scheme.commit(0);
+    scheme.mark_batch_as_fixed(0);
+    transcript_type setup_transcript;
+    scheme.setup(setup_transcript, scheme.preprocess(setup_transcript));
+
+    scheme.append_to_batch(1, make_poly(3));
+    scheme.append_to_batch(1, make_poly(4));
+    scheme.append_to_batch(1, make_poly(5));
+    scheme.commit(1);
+    scheme.append_eval_point(0, value_type(7));
+    scheme.append_eval_point(1, value_type(7));
+    scheme.append_eval_point(1, value_type(11));
+
+    auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("lpc-%%%%-%%%%.bin");
+    ASSERT_TRUE(nil::proof_generator::write_commitment_state_file<Endianness>(path, scheme));
+    auto state = nil::proof_generator::commitment_state_view<Endianness, LpcScheme>::open(path);
+    ASSERT_TRUE(state.has_value());
+    EXPECT_EQ(state->polynomial_values().size(), 2);
+    EXPECT_EQ(state->merkle_tree_nodes().size(), 2);
+    auto reloaded = state->make_commitment_scheme();
+    state.reset();
+    boost::filesystem::remove(path);
+    ASSERT_TRUE(reloaded.has_value());
+    EXPECT_TRUE(*reloaded == scheme);
+
+    transcript_type transcript, reloaded_transcript;
+    const auto proof = scheme.proof_eval(transcript);
+    const auto reloaded_proof = reloaded->proof_eval(reloaded_transcript);
+    EXPECT_TRUE(reloaded_proof == proof);
+    EXPECT_EQ(reloaded_transcript.challenge<ProverType::BlueprintField>(),
+              transcript.challenge<ProverType::BlueprintField>());
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/prover_daemon.hpp>
+
+using nil::proof_generator::prover_job;
+using nil::proof_generator::ProverDaemon;
+using nil::proof_generator::detail::bounded_queue;
+using nil::proof_generator::detail::read_prover_job;
+using nil::proof_generator::detail::spool_directory;
+
+class SpoolDirectoryTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("spool-%%%%-%%%%");
+            boost::filesystem::create_directories(dir);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir);
+        }
+
+        void write_file(const std::string& name, const std::string& content) {
+            std::ofstream((dir / name).string()) << content;
+        }
+
+        boost::filesystem::path dir;
+};
+
+TEST_F(SpoolDirectoryTests, ReadJob) {
+    write_file("job.job", "# comment\n\ntrace=trace.bin\nproof=/proofs/proof.bin\nverify=true\n");
+
+    prover_job job;
+    EXPECT_EQ(read_prover_job(dir / "job.job", dir, job), std::nullopt);
+    EXPECT_EQ(job.trace_file_path, dir / "trace.bin");
+    EXPECT_TRUE(job.assignment_table_file_path.empty());
+    EXPECT_EQ(job.proof_file_path, boost::filesystem::path("/proofs/proof.bin"));
+    EXPECT_EQ(job.json_file_path, boost::filesystem::path("/proofs/proof.bin.json"));
+    EXPECT_TRUE(job.verify);
+}
+
+TEST_F(SpoolDirectoryTests, RejectInvalidJobs) {
+    const std::vector<std::string> invalid_jobs = {
+        "proof=proof.bin\n",
+        "trace=trace.bin\nassignment-table=table.bin\nproof=proof.bin\n",
+        "assignment-table=table.bin\n",
+        "assignment-table=table.bin\nproof=proof.bin\ncolor=red\n",
+        "assignment-table table.bin\nproof=proof.bin\n",
+    };
+    for (const std::string& content : invalid_jobs) {
+        write_file("job.job", content);
+        prover_job job;
+        EXPECT_NE(read_prover_job(dir / "job.job", dir, job), std::nullopt) << content;
+    }
+
+    prover_job job;
+    EXPECT_NE(read_prover_job(dir / "missing.job", dir, job), std::nullopt);
+}
+
+TEST_F(SpoolDirectoryTests, ClaimJobsInOrder) {
+    spool_directory spool(dir);
+    write_file("b.job", "");
+    write_file("a.job", "");
+    write_file("c.txt", "");
+
+    EXPECT_FALSE(spool.stop_requested());
+    EXPECT_EQ(spool.claim_next_job(), "a");
+    EXPECT_TRUE(boost::filesystem::exists(dir / "a.running"));
+    EXPECT_EQ(spool.claim_next_job(), "b");
+    EXPECT_EQ(spool.claim_next_job(), std::nullopt);
+
+    EXPECT_TRUE(spool.finish_job("a", "status=done\n"));
+    EXPECT_FALSE(boost::filesystem::exists(dir / "a.running"));
+    std::ifstream report((dir / "a.report").string());
+    std::string line;
+    std::getline(report, line);
+    EXPECT_EQ(line, "status=done");
+
+    write_file("stop", "");
+    EXPECT_TRUE(spool.stop_requested());
+}
+
+TEST(BoundedQueueTests, DrainAfterClose) {
+    bounded_queue<int> queue(1);
+    std::thread producer([&queue] {
+        for (int i = 0; i < 100; ++i) {
+            queue.push(int(i));
+        }
+        queue.close();
+    });
+
+    int expected = 0;
+    while (std::optional<int> item = queue.pop()) {
+        EXPECT_EQ(*item, expected++);
+    }
+    producer.join();
+    EXPECT_EQ(expected, 100);
+}
+
+class ProverDaemonTests: public SpoolDirectoryTests {
+    protected:
+        using CurveType = nil::crypto3::algebra::curves::pallas;
+        using HashType = nil::crypto3::hashes::keccak_1600<256>;
+        using ProverType = nil::proof_generator::Prover<CurveType, HashType>;
+
+        static constexpr std::size_t lambda = 9;
+        static constexpr std::size_t grind = 0;
+        static constexpr std::size_t expand_factor = 2;
+        static constexpr std::size_t max_quotient_chunks = 0;
+
+        ProverType make_prover(const std::string& circuit_name) const {
+            return ProverType(lambda, expand_factor, max_quotient_chunks, grind, circuit_name);
+        }
+
+        std::vector<std::string> read_report(const std::string& job_name) const {
+            std::ifstream report((dir / (job_name + ".report")).string());
+            std::vector<std::string> lines;
+            for (std::string line; std::getline(report, line);) {
+                lines.push_back(line);
+            }
+            return lines;
+        }
+
+        static bool has_line(const std::vector<std::string>& lines, const std::string& line) {
+            return std::find(lines.begin(), lines.end(), line) != lines.end();
+        }
+};
+
+// Two jobs for the same circuit are served by one daemon: the second one reuses the public preprocessing of the
+// first one, and both proofs verify against public data preprocessed from scratch.
+TEST_F(ProverDaemonTests, ReusePublicDataForTheSameCircuit) {
+    const std::string circuit_name = nil::proof_generator::circuits::COPY;
+    const std::string trace_file_path = std::string(TEST_DATA_DIR) + "increment_multi_tx.pb";
+    write_file("a.job", "trace=" + trace_file_path + "\nproof=a.bin\nverify=true\n");
+    write_file("b.job", "trace=" + trace_file_path + "\nproof=b.bin\nverify=true\n");
+    // Jobs put before the stop file are still served, so the daemon exits once both are done.
+    write_file("stop", "");
+
+    ProverType prover = make_prover(circuit_name);
+    ASSERT_TRUE(prover.setup_prover());
+    ProverDaemon<CurveType, HashType> daemon(prover, circuit_name, dir, std::chrono::milliseconds(10));
+    ASSERT_TRUE(daemon.run());
+
+    const std::vector<std::string> first_report = read_report("a");
+    const std::vector<std::string> second_report = read_report("b");
+    EXPECT_TRUE(has_line(first_report, "status=done"));
+    EXPECT_TRUE(has_line(first_report, "public-data-reused=false"));
+    EXPECT_TRUE(has_line(second_report, "status=done"));
+    EXPECT_TRUE(has_line(second_report, "public-data-reused=true"));
+    EXPECT_FALSE(boost::filesystem::exists(dir / "a.running"));
+    EXPECT_FALSE(boost::filesystem::exists(dir / "b.running"));
+
+    ProverType verifier = make_prover(circuit_name);
+    ASSERT_TRUE(verifier.setup_prover());
+    ASSERT_TRUE(verifier.fill_assignment_table(trace_file_path));
+    ASSERT_TRUE(verifier.preprocess_public_data());
+    EXPECT_TRUE(verifier.verify_from_file(dir / "a.bin"));
+    EXPECT_TRUE(verifier.verify_from_file(dir / "b.bin"));
+}